@@ -14,7 +14,6 @@
 
 #include <string.h>
 
-#define XML_BUFFER_SIZE 1024
 #define XML_TOTAL_ELEMENTS 5
 
 static int xml_start_assetlist_element(void);
@@ -248,21 +247,14 @@ int xml_process_assetlist_file(const char *xml_file_name)
         return 0;
     }
 
-    char buffer[XML_BUFFER_SIZE];
-    int done = 0;
     int error = 0;
 
     xml_parser_reset();
 
-    do {
-        size_t bytes_read = fread(buffer, 1, XML_BUFFER_SIZE, xml_file);
-        done = bytes_read < sizeof(buffer);
-        if (!xml_parser_parse(buffer, (unsigned int) bytes_read, done)) {
-            log_error("Error parsing file", xml_file_name, 0);
-            error = 1;
-            break;
-        }
-    } while (!done);
+    if (!xml_parser_parse_file(xml_file)) {
+        log_error("Error parsing file", xml_file_name, 0);
+        error = 1;
+    }
 
     if (data.current_group && (error || !data.finished)) {
         group_unload_current();
@@ -12,6 +12,7 @@
 #include "figure/action.h"
 #include "figure/figure.h"
 #include "figure/formation.h"
+#include "game/replay.h"
 #include "map/grid.h"
 #include "map/road_access.h"
 
@@ -258,11 +259,13 @@ int building_barracks_create_tower_sentry(building *barracks, int x, int y)
 
 void building_barracks_set_priority(building *barracks, int priority)
 {
+    game_replay_record_command(REPLAY_COMMAND_SET_BARRACKS_PRIORITY, barracks->id, priority, 0);
         barracks->subtype.barracks_priority = priority;
 }
 
 void building_barracks_toggle_delivery(building *barracks)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_BARRACKS_DELIVERY, barracks->id, 0, 0);
     barracks->accepted_goods[RESOURCE_WEAPONS] ^= 1;
 }
 
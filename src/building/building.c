@@ -30,6 +30,7 @@
 #include "figure/formation_legion.h"
 #include "figuretype/missile.h"
 #include "game/difficulty.h"
+#include "game/replay.h"
 #include "game/save_version.h"
 #include "game/undo.h"
 #include "map/building.h"
@@ -237,6 +238,8 @@ building *building_create(building_type type, int x, int y)
 
     if (type == BUILDING_GRANARY) {
         b->resources[RESOURCE_NONE] = FULL_GRANARY;
+    } else if (type == BUILDING_WAREHOUSE) {
+        b->resources[RESOURCE_NONE] = BUILDING_STORAGE_QUANTITY_MAX;
     }
 
     // Set it as accepting all available goods
@@ -755,6 +758,7 @@ int building_is_fort(building_type type)
 
 int building_mothball_toggle(building *b)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_MOTHBALL, b->id, 0, 0);
     if (b->state == BUILDING_STATE_IN_USE) {
         b->state = BUILDING_STATE_MOTHBALLED;
         b->num_workers = 0;
@@ -780,10 +784,17 @@ int building_mothball_set(building *b, int mothball)
 
 unsigned char building_stockpiling_toggle(building *b)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_STOCKPILING, b->id, 0, 0);
     b->data.industry.is_stockpiling = !b->data.industry.is_stockpiling;
     return b->data.industry.is_stockpiling;
 }
 
+void building_depot_set_order(building *b, const order *new_order)
+{
+    game_replay_record_depot_order(b->id, new_order);
+    b->data.depot.current_order = *new_order;
+}
+
 int building_get_levy(const building *b)
 {
     int levy = b->monthly_levy;
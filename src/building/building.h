@@ -288,6 +288,8 @@ int building_get_laborers(building_type type);
 
 unsigned char building_stockpiling_toggle(building *b);
 
+void building_depot_set_order(building *b, const order *new_order);
+
 int building_get_tourism(const building *b);
 
 int building_get_levy(const building *b);
@@ -24,6 +24,7 @@
 #include "core/config.h"
 #include "core/image.h"
 #include "figure/formation.h"
+#include "game/replay.h"
 #include "game/undo.h"
 #include "graphics/window.h"
 #include "map/aqueduct.h"
@@ -68,6 +69,12 @@ static struct {
     int in_progress;
     map_tile start;
     map_tile end;
+    struct {
+        int x_start;
+        int y_start;
+        int x_end;
+        int y_end;
+    } requested; // tiles as given by the player, before any offset is applied
     int cost_preview;
     struct {
         int meadow;
@@ -668,6 +675,8 @@ int building_construction_in_progress(void)
 
 void building_construction_start(int x, int y, int grid_offset)
 {
+    data.requested.x_start = data.requested.x_end = x;
+    data.requested.y_start = data.requested.y_end = y;
     if (data.type == BUILDING_HIGHWAY) {
         building_construction_offset_start_from_orientation(&x, &y, 2);
         grid_offset = map_grid_offset(x, y);
@@ -793,6 +802,8 @@ void building_construction_update(int x, int y, int grid_offset)
 {
     building_type type = building_construction_type();
     if (grid_offset) {
+        data.requested.x_end = x;
+        data.requested.y_end = y;
         if (type == BUILDING_HIGHWAY) {
             building_construction_offset_start_from_orientation(&x, &y, 2);
             grid_offset = map_grid_offset(x, y);
@@ -1022,6 +1033,8 @@ void building_construction_offset_start_from_orientation(int *x, int *y, int siz
 
 void building_construction_place(void)
 {
+    game_replay_record_construction(data.type, data.requested.x_start, data.requested.y_start,
+        data.requested.x_end, data.requested.y_end);
     data.cost_preview = 0;
     data.in_progress = 0;
     int x_start = data.start.x;
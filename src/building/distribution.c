@@ -6,6 +6,7 @@
 #include "city/resource.h"
 #include "core/calc.h"
 #include "empire/city.h"
+#include "game/replay.h"
 
 #include <string.h>
 
@@ -26,6 +27,7 @@ int building_distribution_check_if_accepts_nothing(const building *b)
 
 void building_distribution_toggle_good_accepted(building *b, resource_type resource)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_GOOD_ACCEPTED, b->id, resource, 0);
     if (b->accepted_goods[resource] == 0) {
         b->accepted_goods[resource] = 1;
     } else {
@@ -150,8 +152,7 @@ static void update_food_resource(resource_storage_info *info, resource_type reso
 
 static void update_good_resource(resource_storage_info *info, resource_type resource, building *b, int distance)
 {
-    if (distance < info[resource].min_distance &&
-        !city_resource_is_stockpiled(resource) && building_warehouse_get_available_amount(b, resource)) {
+    if (distance < info[resource].min_distance && building_warehouse_get_available_amount(b, resource)) {
         info[resource].min_distance = distance;
         info[resource].building_id = b->id;
     }
@@ -165,16 +166,6 @@ static int is_invalid_destination(building *b, int permission, int road_network)
         !building_storage_get_permission(permission, b));
 }
 
-static int is_food_needed(const resource_storage_info info[RESOURCE_MAX])
-{
-    for (resource_type r = RESOURCE_MIN_FOOD; r < RESOURCE_MAX_FOOD; r++) {
-        if (info[r].needed) {
-            return 1;
-        }
-    }
-    return 0;
-}
-
 static int get_resource_storages(resource_storage_info info[RESOURCE_MAX],
     building_type type, int road_network, int x, int y, int w, int h, int max_distance)
 {
@@ -183,8 +174,24 @@ static int get_resource_storages(resource_storage_info info[RESOURCE_MAX],
         info[r].building_id = 0;
     }
 
+    // Gather the resources to look for once, instead of checking every resource for every storage
+    resource_type needed_food[RESOURCE_MAX_FOOD];
+    int num_needed_food = 0;
+    for (resource_type r = RESOURCE_MIN_FOOD; r < RESOURCE_MAX_FOOD; r++) {
+        if (info[r].needed) {
+            needed_food[num_needed_food++] = r;
+        }
+    }
+    resource_type needed_goods[RESOURCE_MAX_NON_FOOD - RESOURCE_MIN_NON_FOOD];
+    int num_needed_goods = 0;
+    for (resource_type r = RESOURCE_MIN_NON_FOOD; r < RESOURCE_MAX_NON_FOOD; r++) {
+        if (resource_is_storable(r) && info[r].needed && !city_resource_is_stockpiled(r)) {
+            needed_goods[num_needed_goods++] = r;
+        }
+    }
+
     int permission = building_storage_get_permission_from_building_type(type);
-    if (is_food_needed(info)) {
+    if (num_needed_food) {
         for (building *b = building_first_of_type(BUILDING_GRANARY); b; b = b->next_of_type) {
             // Looter walkers have no type
             if (type && is_invalid_destination(b, permission, road_network)) {
@@ -192,22 +199,20 @@ static int get_resource_storages(resource_storage_info info[RESOURCE_MAX],
             }
             int distance = building_dist(x, y, w, h, b);
 
-            for (int r = RESOURCE_MIN_FOOD; r < RESOURCE_MAX_FOOD; r++) {
-                if (info[r].needed) {
-                    update_food_resource(info, r, b, distance);
-                }
+            for (int i = 0; i < num_needed_food; i++) {
+                update_food_resource(info, needed_food[i], b, distance);
             }
         }
     }
-    for (building *b = building_first_of_type(BUILDING_WAREHOUSE); b; b = b->next_of_type) {
-        if (type && is_invalid_destination(b, permission, road_network)) {
-            continue;
-        }
-        int distance = building_dist(x, y, w, h, b);
+    if (num_needed_goods) {
+        for (building *b = building_first_of_type(BUILDING_WAREHOUSE); b; b = b->next_of_type) {
+            if (type && is_invalid_destination(b, permission, road_network)) {
+                continue;
+            }
+            int distance = building_dist(x, y, w, h, b);
 
-        for (resource_type r = RESOURCE_MIN_NON_FOOD; r < RESOURCE_MAX_NON_FOOD; r++) {
-            if (resource_is_storable(r) && info[r].needed) {
-                update_good_resource(info, r, b, distance);
+            for (int i = 0; i < num_needed_goods; i++) {
+                update_good_resource(info, needed_goods[i], b, distance);
             }
         }
     }
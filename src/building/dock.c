@@ -10,6 +10,7 @@
 #include "figure/trader.h"
 #include "figure/visited_buildings.h"
 #include "figuretype/trader.h"
+#include "game/replay.h"
 #include "game/resource.h"
 #include "map/figure.h"
 #include "map/grid.h"
@@ -412,6 +413,7 @@ int building_dock_can_trade_with_route(int route_id, int dock_id)
 
 void building_dock_set_can_trade_with_route(int route_id, int dock_id, int can_trade)
 {
+    game_replay_record_command(REPLAY_COMMAND_SET_DOCK_TRADE_ROUTE, route_id, dock_id, can_trade);
     building *dock = building_get(dock_id);
     if (!dock->data.dock.has_accepted_route_ids) {
         dock->data.dock.has_accepted_route_ids = 1;
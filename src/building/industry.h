@@ -26,6 +26,8 @@ int building_industry_get_max_progress(const building *b);
 int building_stockpiling_enabled(building *b);
 int building_industry_has_produced_resource(building *b);
 void building_industry_start_new_production(building *b);
+/** Switches a city mint between minting denarii and smelting gold, dropping its progress. */
+void building_industry_switch_mint_output(building *b);
 int building_loads_stored(const building *b);
 
 void building_bless_farms(void);
@@ -11,6 +11,7 @@
 #include "core/calc.h"
 #include "core/log.h"
 #include "empire/city.h"
+#include "game/replay.h"
 #include "map/building_tiles.h"
 #include "map/grid.h"
 #include "map/orientation.h"
@@ -271,6 +272,7 @@ int building_monument_add_module(building *b, int module)
         (b->monument.upgrades && b->type != BUILDING_CARAVANSERAI && b->type != BUILDING_LIGHTHOUSE)) {
         return 0;
     }
+    game_replay_record_command(REPLAY_COMMAND_ADD_MONUMENT_MODULE, b->id, module, 0);
     b->monument.upgrades = module;
     map_building_tiles_add(b->id, b->x, b->y, b->size, building_image_get(b), TERRAIN_BUILDING);
     return 1;
@@ -793,6 +795,7 @@ int building_monument_is_construction_halted(building *b)
 
 int building_monument_toggle_construction_halted(building *b)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_MONUMENT_HALTED, b->id, 0, 0);
     if (b->state == BUILDING_STATE_MOTHBALLED) {
         b->state = BUILDING_STATE_IN_USE;
         return 0;
@@ -2,12 +2,16 @@
 
 #include "building/building.h"
 #include "building/type.h"
+#include "figure/roamer_preview.h"
+#include "game/replay.h"
 
 void building_roadblock_set_permission(roadblock_permission p, building *b)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_ROADBLOCK_PERMISSION, p, b->id, 0);
     if (building_type_is_roadblock(b->type)) {
         int permission_bit = 1 << p;
         b->data.roadblock.exceptions ^= permission_bit;
+        figure_roamer_preview_invalidate();
     }
 }
 
@@ -46,6 +50,7 @@ int building_type_is_roadblock(building_type type)
 
 void building_roadblock_accept_none(building *b)
 {
+    game_replay_record_command(REPLAY_COMMAND_ROADBLOCK_ACCEPT_ALL, b->id, 0, 0);
     if (building_type_is_roadblock(b->type)) {
         b->data.roadblock.exceptions = 0;
     }
@@ -53,6 +58,7 @@ void building_roadblock_accept_none(building *b)
 
 void building_roadblock_accept_all(building *b)
 {
+    game_replay_record_command(REPLAY_COMMAND_ROADBLOCK_ACCEPT_ALL, b->id, 1, 0);
     if (building_type_is_roadblock(b->type)) {
         b->data.roadblock.exceptions = ROADBLOCK_PERMISSION_ALL;
     }
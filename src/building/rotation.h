@@ -23,4 +23,7 @@ void building_rotation_remove_rotation(void);
 
 int building_rotation_type_has_rotations(building_type type);
 
+void building_rotation_get_state(int *rotation, int *extra_rotation, int *road_orientation);
+void building_rotation_set_state(int rotation, int extra_rotation, int road_orientation);
+
 #endif // BUILDING_ROTATION_H
@@ -42,200 +42,203 @@ static void write_type_data(buffer *buf, const building *b)
     size_t buffer_index = buf->index;
 
     if (building_is_house(b->type)) {
-        buffer_write_u8(buf, b->data.house.theater);
-        buffer_write_u8(buf, b->data.house.amphitheater_actor);
-        buffer_write_u8(buf, b->data.house.amphitheater_gladiator);
-        buffer_write_u8(buf, b->data.house.colosseum_gladiator);
-        buffer_write_u8(buf, b->data.house.colosseum_lion);
-        buffer_write_u8(buf, b->data.house.hippodrome);
-        buffer_write_u8(buf, b->data.house.school);
-        buffer_write_u8(buf, b->data.house.library);
-        buffer_write_u8(buf, b->data.house.academy);
-        buffer_write_u8(buf, b->data.house.barber);
-        buffer_write_u8(buf, b->data.house.clinic);
-        buffer_write_u8(buf, b->data.house.bathhouse);
-        buffer_write_u8(buf, b->data.house.hospital);
-        buffer_write_u8(buf, b->data.house.temple_ceres);
-        buffer_write_u8(buf, b->data.house.temple_neptune);
-        buffer_write_u8(buf, b->data.house.temple_mercury);
-        buffer_write_u8(buf, b->data.house.temple_mars);
-        buffer_write_u8(buf, b->data.house.temple_venus);
-        buffer_write_u8(buf, b->data.house.no_space_to_expand);
-        buffer_write_u8(buf, b->data.house.num_foods);
-        buffer_write_u8(buf, b->data.house.entertainment);
-        buffer_write_u8(buf, b->data.house.education);
-        buffer_write_u8(buf, b->data.house.health);
-        buffer_write_u8(buf, b->data.house.num_gods);
-        buffer_write_u8(buf, b->data.house.devolve_delay);
-        buffer_write_u8(buf, b->data.house.evolve_text_id);
+        buffer_write_u8_unchecked(buf, b->data.house.theater);
+        buffer_write_u8_unchecked(buf, b->data.house.amphitheater_actor);
+        buffer_write_u8_unchecked(buf, b->data.house.amphitheater_gladiator);
+        buffer_write_u8_unchecked(buf, b->data.house.colosseum_gladiator);
+        buffer_write_u8_unchecked(buf, b->data.house.colosseum_lion);
+        buffer_write_u8_unchecked(buf, b->data.house.hippodrome);
+        buffer_write_u8_unchecked(buf, b->data.house.school);
+        buffer_write_u8_unchecked(buf, b->data.house.library);
+        buffer_write_u8_unchecked(buf, b->data.house.academy);
+        buffer_write_u8_unchecked(buf, b->data.house.barber);
+        buffer_write_u8_unchecked(buf, b->data.house.clinic);
+        buffer_write_u8_unchecked(buf, b->data.house.bathhouse);
+        buffer_write_u8_unchecked(buf, b->data.house.hospital);
+        buffer_write_u8_unchecked(buf, b->data.house.temple_ceres);
+        buffer_write_u8_unchecked(buf, b->data.house.temple_neptune);
+        buffer_write_u8_unchecked(buf, b->data.house.temple_mercury);
+        buffer_write_u8_unchecked(buf, b->data.house.temple_mars);
+        buffer_write_u8_unchecked(buf, b->data.house.temple_venus);
+        buffer_write_u8_unchecked(buf, b->data.house.no_space_to_expand);
+        buffer_write_u8_unchecked(buf, b->data.house.num_foods);
+        buffer_write_u8_unchecked(buf, b->data.house.entertainment);
+        buffer_write_u8_unchecked(buf, b->data.house.education);
+        buffer_write_u8_unchecked(buf, b->data.house.health);
+        buffer_write_u8_unchecked(buf, b->data.house.num_gods);
+        buffer_write_u8_unchecked(buf, b->data.house.devolve_delay);
+        buffer_write_u8_unchecked(buf, b->data.house.evolve_text_id);
     } else if (b->type == BUILDING_CARAVANSERAI || b->type == BUILDING_LARGE_TEMPLE_CERES ||
         b->type == BUILDING_LARGE_TEMPLE_VENUS) {
-        buffer_write_u8(buf, b->data.market.fetch_inventory_id);
+        buffer_write_u8_unchecked(buf, b->data.market.fetch_inventory_id);
     } else if (building_has_supplier_inventory(b->type)) {
-        buffer_write_u8(buf, b->data.market.fetch_inventory_id);
-        buffer_write_u8(buf, b->data.market.is_mess_hall);
+        buffer_write_u8_unchecked(buf, b->data.market.fetch_inventory_id);
+        buffer_write_u8_unchecked(buf, b->data.market.is_mess_hall);
     } else if (b->type == BUILDING_DEPOT) {
-        buffer_write_i8(buf, b->data.depot.current_order.resource_type);
-        buffer_write_i32(buf, b->data.depot.current_order.src_storage_id);
-        buffer_write_i32(buf, b->data.depot.current_order.dst_storage_id);
-        buffer_write_i8(buf, b->data.depot.current_order.condition.condition_type);
-        buffer_write_i8(buf, b->data.depot.current_order.condition.threshold);
+        buffer_write_i8_unchecked(buf, b->data.depot.current_order.resource_type);
+        buffer_write_i32_unchecked(buf, b->data.depot.current_order.src_storage_id);
+        buffer_write_i32_unchecked(buf, b->data.depot.current_order.dst_storage_id);
+        buffer_write_i8_unchecked(buf, b->data.depot.current_order.condition.condition_type);
+        buffer_write_i8_unchecked(buf, b->data.depot.current_order.condition.threshold);
         for (int i = 0; i < 3; i++) {
-            buffer_write_i16(buf, b->data.distribution.cartpusher_ids[i]);
+            buffer_write_i16_unchecked(buf, b->data.distribution.cartpusher_ids[i]);
         }
     } else if (b->type == BUILDING_DOCK) {
-        buffer_write_i16(buf, b->data.dock.queued_docker_id);
-        buffer_write_u8(buf, b->data.dock.has_accepted_route_ids);
-        buffer_write_i32(buf, b->data.dock.accepted_route_ids);
-        buffer_write_u8(buf, b->data.dock.num_ships);
-        buffer_write_i8(buf, b->data.dock.orientation);
+        buffer_write_i16_unchecked(buf, b->data.dock.queued_docker_id);
+        buffer_write_u8_unchecked(buf, b->data.dock.has_accepted_route_ids);
+        buffer_write_i32_unchecked(buf, b->data.dock.accepted_route_ids);
+        buffer_write_u8_unchecked(buf, b->data.dock.num_ships);
+        buffer_write_i8_unchecked(buf, b->data.dock.orientation);
         for (int i = 0; i < 3; i++) {
-            buffer_write_i16(buf, b->data.distribution.cartpusher_ids[i]);
+            buffer_write_i16_unchecked(buf, b->data.distribution.cartpusher_ids[i]);
         }
-        buffer_write_i16(buf, b->data.dock.trade_ship_id);
+        buffer_write_i16_unchecked(buf, b->data.dock.trade_ship_id);
     } else if (building_type_is_roadblock(b->type)) {
-        buffer_write_u16(buf, b->data.roadblock.exceptions);
+        buffer_write_u16_unchecked(buf, b->data.roadblock.exceptions);
         if (b->type == BUILDING_WAREHOUSE) {
-            buffer_write_u16(buf, b->data.rubble.og_type);
-            buffer_write_u16(buf, b->data.rubble.og_grid_offset);
-            buffer_write_u8(buf, b->data.rubble.og_size);
-            buffer_write_u8(buf, b->data.rubble.og_orientation);
+            buffer_write_u16_unchecked(buf, b->data.rubble.og_type);
+            buffer_write_u16_unchecked(buf, b->data.rubble.og_grid_offset);
+            buffer_write_u8_unchecked(buf, b->data.rubble.og_size);
+            buffer_write_u8_unchecked(buf, b->data.rubble.og_orientation);
         }
     } else if (is_industry_type(b)) {
-        buffer_write_i16(buf, b->data.industry.progress);
-        buffer_write_u8(buf, b->data.industry.is_stockpiling);
-        buffer_write_u8(buf, b->data.industry.has_fish);
-        buffer_write_u8(buf, b->data.industry.blessing_days_left);
-        buffer_write_u8(buf, b->data.industry.orientation);
-        buffer_write_u8(buf, b->data.industry.has_raw_materials);
-        buffer_write_u8(buf, b->data.industry.curse_days_left);
+        buffer_write_i16_unchecked(buf, b->data.industry.progress);
+        buffer_write_u8_unchecked(buf, b->data.industry.is_stockpiling);
+        buffer_write_u8_unchecked(buf, b->data.industry.has_fish);
+        buffer_write_u8_unchecked(buf, b->data.industry.blessing_days_left);
+        buffer_write_u8_unchecked(buf, b->data.industry.orientation);
+        buffer_write_u8_unchecked(buf, b->data.industry.has_raw_materials);
+        buffer_write_u8_unchecked(buf, b->data.industry.curse_days_left);
         if ((b->type >= BUILDING_WHEAT_FARM && b->type <= BUILDING_POTTERY_WORKSHOP) || b->type == BUILDING_WHARF) {
-            buffer_write_u8(buf, b->data.industry.age_months);
-            buffer_write_u8(buf, b->data.industry.average_production_per_month);
-            buffer_write_i16(buf, b->data.industry.production_current_month);
+            buffer_write_u8_unchecked(buf, b->data.industry.age_months);
+            buffer_write_u8_unchecked(buf, b->data.industry.average_production_per_month);
+            buffer_write_i16_unchecked(buf, b->data.industry.production_current_month);
         }
-        buffer_write_i16(buf, b->data.industry.fishing_boat_id);
+        buffer_write_i16_unchecked(buf, b->data.industry.fishing_boat_id);
     } else if (b->type == BUILDING_BURNING_RUIN || b->type == BUILDING_WAREHOUSE_SPACE) {
-        buffer_write_u16(buf, b->data.rubble.og_type);
-        buffer_write_u16(buf, b->data.rubble.og_grid_offset);
-        buffer_write_u8(buf, b->data.rubble.og_size);
-        buffer_write_u8(buf, b->data.rubble.og_orientation);
+        buffer_write_u16_unchecked(buf, b->data.rubble.og_type);
+        buffer_write_u16_unchecked(buf, b->data.rubble.og_grid_offset);
+        buffer_write_u8_unchecked(buf, b->data.rubble.og_size);
+        buffer_write_u8_unchecked(buf, b->data.rubble.og_orientation);
     } else {
-        buffer_write_u8(buf, b->data.entertainment.num_shows);
-        buffer_write_u8(buf, b->data.entertainment.days1);
-        buffer_write_u8(buf, b->data.entertainment.days2);
-        buffer_write_u8(buf, b->data.entertainment.play);
+        buffer_write_u8_unchecked(buf, b->data.entertainment.num_shows);
+        buffer_write_u8_unchecked(buf, b->data.entertainment.days1);
+        buffer_write_u8_unchecked(buf, b->data.entertainment.days2);
+        buffer_write_u8_unchecked(buf, b->data.entertainment.play);
     }
     int remaining_bytes = TYPE_DATA_CURRENT_BUFFER_SIZE - (int) (buf->index - buffer_index);
     for (int i = 0; i < remaining_bytes; i++) {
-        buffer_write_u8(buf, 0);
+        buffer_write_u8_unchecked(buf, 0);
     }
 }
 
 void building_state_save_to_buffer(buffer *buf, const building *b)
 {
-    buffer_write_u8(buf, b->state);
-    buffer_write_u8(buf, b->faction_id);
-    buffer_write_u8(buf, b->unknown_value);
-    buffer_write_u8(buf, b->size);
-    buffer_write_u8(buf, b->house_is_merged);
-    buffer_write_u8(buf, b->house_size);
-    buffer_write_u8(buf, b->x);
-    buffer_write_u8(buf, b->y);
-    buffer_write_i16(buf, b->grid_offset);
-    buffer_write_i16(buf, b->type);
-    buffer_write_i16(buf, b->subtype.house_level); // which union field we use does not matter
-    buffer_write_u8(buf, b->road_network_id);
-    buffer_write_u8(buf, b->monthly_levy);
-    buffer_write_u16(buf, b->created_sequence);
-    buffer_write_i16(buf, b->houses_covered);
-    buffer_write_i16(buf, b->percentage_houses_covered);
-    buffer_write_i16(buf, b->house_population);
-    buffer_write_i16(buf, b->house_population_room);
-    buffer_write_i16(buf, b->distance_from_entry);
-    buffer_write_i16(buf, b->house_highest_population);
-    buffer_write_i16(buf, b->house_unreachable_ticks);
-    buffer_write_u8(buf, b->road_access_x);
-    buffer_write_u8(buf, b->road_access_y);
-    buffer_write_i16(buf, b->figure_id);
-    buffer_write_i16(buf, b->figure_id2);
-    buffer_write_i16(buf, b->immigrant_figure_id);
-    buffer_write_i16(buf, b->figure_id4);
-    buffer_write_u8(buf, b->figure_spawn_delay);
-    buffer_write_u8(buf, b->days_since_offering);
-    buffer_write_u8(buf, b->figure_roam_direction);
-    buffer_write_u8(buf, b->has_water_access);
-    buffer_write_u8(buf, b->house_tavern_wine_access);
-    buffer_write_u8(buf, b->house_tavern_food_access);
-    buffer_write_i16(buf, b->prev_part_building_id);
-    buffer_write_i16(buf, b->next_part_building_id);
-    buffer_write_i16(buf, 0); // Q: what was here and why was it removed? can we replace it with something useful?
-    buffer_write_u8(buf, b->house_sentiment_message);
-    buffer_write_u8(buf, b->has_well_access);
-    buffer_write_i16(buf, b->num_workers);
-    buffer_write_u8(buf, b->labor_category);
-    buffer_write_u8(buf, b->output_resource_id);
-    buffer_write_u8(buf, b->has_road_access);
-    buffer_write_u8(buf, b->house_criminal_active);
-    buffer_write_i16(buf, b->damage_risk);
-    buffer_write_i16(buf, b->fire_risk);
-    buffer_write_i16(buf, b->fire_duration);
-    buffer_write_u8(buf, b->fire_proof);
-    buffer_write_u8(buf, b->house_figure_generation_delay);
-    buffer_write_u8(buf, b->house_tax_coverage);
-    buffer_write_u8(buf, b->house_pantheon_access);
-    buffer_write_i16(buf, b->formation_id);
+    if (!buffer_reserve(buf, BUILDING_STATE_CURRENT_BUFFER_SIZE)) {
+        return;
+    }
+    buffer_write_u8_unchecked(buf, b->state);
+    buffer_write_u8_unchecked(buf, b->faction_id);
+    buffer_write_u8_unchecked(buf, b->unknown_value);
+    buffer_write_u8_unchecked(buf, b->size);
+    buffer_write_u8_unchecked(buf, b->house_is_merged);
+    buffer_write_u8_unchecked(buf, b->house_size);
+    buffer_write_u8_unchecked(buf, b->x);
+    buffer_write_u8_unchecked(buf, b->y);
+    buffer_write_i16_unchecked(buf, b->grid_offset);
+    buffer_write_i16_unchecked(buf, b->type);
+    buffer_write_i16_unchecked(buf, b->subtype.house_level); // which union field we use does not matter
+    buffer_write_u8_unchecked(buf, b->road_network_id);
+    buffer_write_u8_unchecked(buf, b->monthly_levy);
+    buffer_write_u16_unchecked(buf, b->created_sequence);
+    buffer_write_i16_unchecked(buf, b->houses_covered);
+    buffer_write_i16_unchecked(buf, b->percentage_houses_covered);
+    buffer_write_i16_unchecked(buf, b->house_population);
+    buffer_write_i16_unchecked(buf, b->house_population_room);
+    buffer_write_i16_unchecked(buf, b->distance_from_entry);
+    buffer_write_i16_unchecked(buf, b->house_highest_population);
+    buffer_write_i16_unchecked(buf, b->house_unreachable_ticks);
+    buffer_write_u8_unchecked(buf, b->road_access_x);
+    buffer_write_u8_unchecked(buf, b->road_access_y);
+    buffer_write_i16_unchecked(buf, b->figure_id);
+    buffer_write_i16_unchecked(buf, b->figure_id2);
+    buffer_write_i16_unchecked(buf, b->immigrant_figure_id);
+    buffer_write_i16_unchecked(buf, b->figure_id4);
+    buffer_write_u8_unchecked(buf, b->figure_spawn_delay);
+    buffer_write_u8_unchecked(buf, b->days_since_offering);
+    buffer_write_u8_unchecked(buf, b->figure_roam_direction);
+    buffer_write_u8_unchecked(buf, b->has_water_access);
+    buffer_write_u8_unchecked(buf, b->house_tavern_wine_access);
+    buffer_write_u8_unchecked(buf, b->house_tavern_food_access);
+    buffer_write_i16_unchecked(buf, b->prev_part_building_id);
+    buffer_write_i16_unchecked(buf, b->next_part_building_id);
+    buffer_write_i16_unchecked(buf, 0); // Q: what was here and why was it removed? can we replace it with something useful?
+    buffer_write_u8_unchecked(buf, b->house_sentiment_message);
+    buffer_write_u8_unchecked(buf, b->has_well_access);
+    buffer_write_i16_unchecked(buf, b->num_workers);
+    buffer_write_u8_unchecked(buf, b->labor_category);
+    buffer_write_u8_unchecked(buf, b->output_resource_id);
+    buffer_write_u8_unchecked(buf, b->has_road_access);
+    buffer_write_u8_unchecked(buf, b->house_criminal_active);
+    buffer_write_i16_unchecked(buf, b->damage_risk);
+    buffer_write_i16_unchecked(buf, b->fire_risk);
+    buffer_write_i16_unchecked(buf, b->fire_duration);
+    buffer_write_u8_unchecked(buf, b->fire_proof);
+    buffer_write_u8_unchecked(buf, b->house_figure_generation_delay);
+    buffer_write_u8_unchecked(buf, b->house_tax_coverage);
+    buffer_write_u8_unchecked(buf, b->house_pantheon_access);
+    buffer_write_i16_unchecked(buf, b->formation_id);
     write_type_data(buf, b);
-    buffer_write_i32(buf, b->tax_income_or_storage);
-    buffer_write_u8(buf, b->house_days_without_food);
-    buffer_write_u8(buf, b->has_plague);
-    buffer_write_i8(buf, b->desirability);
-    buffer_write_u8(buf, b->is_deleted);
-    buffer_write_u8(buf, b->is_close_to_water);
-    buffer_write_u8(buf, b->storage_id);
-    buffer_write_i8(buf, b->sentiment.house_happiness); // which union field we use does not matter
-    buffer_write_u8(buf, b->show_on_problem_overlay);
+    buffer_write_i32_unchecked(buf, b->tax_income_or_storage);
+    buffer_write_u8_unchecked(buf, b->house_days_without_food);
+    buffer_write_u8_unchecked(buf, b->has_plague);
+    buffer_write_i8_unchecked(buf, b->desirability);
+    buffer_write_u8_unchecked(buf, b->is_deleted);
+    buffer_write_u8_unchecked(buf, b->is_close_to_water);
+    buffer_write_u8_unchecked(buf, b->storage_id);
+    buffer_write_i8_unchecked(buf, b->sentiment.house_happiness); // which union field we use does not matter
+    buffer_write_u8_unchecked(buf, b->show_on_problem_overlay);
 
     // expanded building data
     // Monuments
-    buffer_write_i32(buf, b->monument.upgrades);
-    buffer_write_i16(buf, b->monument.progress);
-    buffer_write_i16(buf, b->monument.phase);
+    buffer_write_i32_unchecked(buf, b->monument.upgrades);
+    buffer_write_i16_unchecked(buf, b->monument.progress);
+    buffer_write_i16_unchecked(buf, b->monument.phase);
 
     // Tourism
-    buffer_write_u8(buf, b->house_arena_gladiator);
-    buffer_write_u8(buf, b->house_arena_lion);
-    buffer_write_u8(buf, b->is_tourism_venue);
-    buffer_write_u8(buf, b->tourism_disabled);
-    buffer_write_u8(buf, b->tourism_income);
-    buffer_write_u8(buf, b->tourism_income_this_year);
+    buffer_write_u8_unchecked(buf, b->house_arena_gladiator);
+    buffer_write_u8_unchecked(buf, b->house_arena_lion);
+    buffer_write_u8_unchecked(buf, b->is_tourism_venue);
+    buffer_write_u8_unchecked(buf, b->tourism_disabled);
+    buffer_write_u8_unchecked(buf, b->tourism_income);
+    buffer_write_u8_unchecked(buf, b->tourism_income_this_year);
 
     // Variants and upgrades
-    buffer_write_u8(buf, b->variant);
-    buffer_write_u8(buf, b->upgrade_level);
+    buffer_write_u8_unchecked(buf, b->variant);
+    buffer_write_u8_unchecked(buf, b->upgrade_level);
 
     //strikes
-    buffer_write_u8(buf, b->strike_duration_days);
+    buffer_write_u8_unchecked(buf, b->strike_duration_days);
 
     // sickness
-    buffer_write_u8(buf, b->sickness_level);
-    buffer_write_u8(buf, b->sickness_duration);
-    buffer_write_u8(buf, b->sickness_doctor_cure);
-    buffer_write_u8(buf, b->fumigation_frame);
-    buffer_write_u8(buf, b->fumigation_direction);
+    buffer_write_u8_unchecked(buf, b->sickness_level);
+    buffer_write_u8_unchecked(buf, b->sickness_duration);
+    buffer_write_u8_unchecked(buf, b->sickness_doctor_cure);
+    buffer_write_u8_unchecked(buf, b->fumigation_frame);
+    buffer_write_u8_unchecked(buf, b->fumigation_direction);
 
     // extra resources
     for (int i = 0; i < RESOURCE_MAX; i++) {
-        buffer_write_i16(buf, b->resources[i]);
+        buffer_write_i16_unchecked(buf, b->resources[i]);
     }
 
     // accepted goods
     for (int i = 0; i < RESOURCE_MAX; i++) {
-        buffer_write_u8(buf, b->accepted_goods[i]);
+        buffer_write_u8_unchecked(buf, b->accepted_goods[i]);
     }
 
     // latrines
-    buffer_write_u8(buf, b->has_latrines_access);
+    buffer_write_u8_unchecked(buf, b->has_latrines_access);
 
     // New building state code should always be added at the end to preserve savegame retrocompatibility
     // Also, don't forget to update BUILDING_STATE_CURRENT_BUFFER_SIZE and if possible, add a new macro like
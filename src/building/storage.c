@@ -12,6 +12,7 @@
 #include "core/string.h"
 #include "city/resource.h"
 #include "empire/city.h"
+#include "game/replay.h"
 #include "game/resource.h"
 #include "game/save_version.h"
 #include "graphics/text.h"
@@ -160,6 +161,7 @@ void building_storage_set_data(int storage_id, building_storage new_data)
 
 void building_storage_toggle_empty_all(int storage_id)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_STORAGE_EMPTY_ALL, storage_id, 0, 0);
     array_item(storages, storage_id)->storage.empty_all ^= 1;
 }
 
@@ -265,6 +267,7 @@ resource_type building_storage_get_highest_quantity_resource(building *b)
 
 void building_storage_cycle_resource_state(int storage_id, resource_type resource_id, int reverse_order)
 {
+    game_replay_record_command(REPLAY_COMMAND_CYCLE_STORAGE_STATE, storage_id, resource_id, reverse_order);
     resource_storage_entry *entry = &array_item(storages, storage_id)->storage.resource_state[resource_id];
     int num_states = BUILDING_STORAGE_STATE_MAX;
     int ordered[BUILDING_STORAGE_STATE_MAX] = { BUILDING_STORAGE_STATE_NOT_ACCEPTING, BUILDING_STORAGE_STATE_ACCEPTING,
@@ -288,6 +291,7 @@ void building_storage_cycle_resource_state(int storage_id, resource_type resourc
 
 void building_storage_toggle_permission(building_storage_permission_states p, building *b)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_STORAGE_PERMISSION, p, b->id, 0);
     int permission_bit = 1 << p;
     array_item(storages, b->storage_id)->storage.permissions ^= permission_bit;
 }
@@ -301,6 +305,7 @@ int building_storage_get_permission(building_storage_permission_states p, buildi
 
 void building_storage_set_permission(building_storage_permission_states p, building *b, int enable)
 {
+    game_replay_record_command(REPLAY_COMMAND_SET_STORAGE_PERMISSION, p, b->id, enable);
     int permission_bit = 1 << p;
     int *permissions = &array_item(storages, b->storage_id)->storage.permissions;
 
@@ -313,6 +318,7 @@ void building_storage_set_permission(building_storage_permission_states p, build
 
 void building_storage_cycle_partial_resource_state(int storage_id, resource_type resource_id, int reverse_order)
 {
+    game_replay_record_command(REPLAY_COMMAND_CYCLE_PARTIAL_STORAGE_STATE, storage_id, resource_id, reverse_order);
     resource_storage_entry *entry = &array_item(storages, storage_id)->storage.resource_state[resource_id];
 
     if (entry->state == BUILDING_STORAGE_STATE_NOT_ACCEPTING) {
@@ -12,12 +12,15 @@
 #include "core/calc.h"
 #include "core/image.h"
 #include "core/config.h"
+#include "core/log.h"
 #include "empire/trade_prices.h"
 #include "figure/figure.h"
 #include "game/tutorial.h"
 #include "map/image.h"
 #include "scenario/property.h"
 
+#include <string.h>
+
 #define INFINITE 10000
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
@@ -68,7 +71,6 @@ int building_warehouse_get_amount(building *warehouse, int resource)
 
 int building_warehouse_get_free_space_amount(building *b)
 {
-    building_warehouse_recount_resources(b); //recount, since free space in warehouse is tied to individual spaces
     return b->resources[RESOURCE_NONE];
 }
 
@@ -134,18 +136,9 @@ static building *building_warehouse_find_space(building *warehouse, int resource
     return 0;
 }
 
-void building_warehouse_recount_resources(building *main)
+static void count_space_resources(building *main, int totals[RESOURCE_MAX], int set_images)
 {
-    //helper to reflect the resources in the main warehouse, like granary does
-    if (!main || main->type != BUILDING_WAREHOUSE) {
-        return;
-    }
-
-    // Reset all resource counters in the main warehouse
-    for (int r = 0; r < RESOURCE_MAX; r++) {
-        main->resources[r] = 0;
-    }
-
+    memset(totals, 0, sizeof(int) * RESOURCE_MAX);
     building *space = main;
     for (int i = 0; i < 8; i++) {
         space = building_next(space);
@@ -155,16 +148,69 @@ void building_warehouse_recount_resources(building *main)
 
         int resource = space->subtype.warehouse_resource_id;
         if (resource > RESOURCE_NONE && resource < RESOURCE_MAX) {
-            main->resources[resource] += space->resources[resource];
+            totals[resource] += space->resources[resource];
+        }
+        if (set_images) {
+            building_warehouse_space_set_image(space, resource);
         }
-        building_warehouse_space_set_image(space, resource);
     }
     // Total sum of all loads (regardless of type)
     int total_loads = 0;
     for (int r = 1; r < RESOURCE_MAX; r++) {
-        total_loads += main->resources[r];
+        total_loads += totals[r];
+    }
+    totals[RESOURCE_NONE] = BUILDING_STORAGE_QUANTITY_MAX - total_loads;
+}
+
+void building_warehouse_recount_resources(building *main)
+{
+    //helper to reflect the resources in the main warehouse, like granary does
+    if (!main || main->type != BUILDING_WAREHOUSE) {
+        return;
+    }
+    int totals[RESOURCE_MAX];
+    count_space_resources(main, totals, 1);
+    for (int r = 0; r < RESOURCE_MAX; r++) {
+        main->resources[r] = totals[r];
+    }
+}
+
+void building_warehouses_recount_resources(void)
+{
+    for (building *b = building_first_of_type(BUILDING_WAREHOUSE); b; b = b->next_of_type) {
+        building_warehouse_recount_resources(b);
+    }
+}
+
+int building_warehouses_check_resources(void)
+{
+    int mismatches = 0;
+    for (building *b = building_first_of_type(BUILDING_WAREHOUSE); b; b = b->next_of_type) {
+        if (b->state != BUILDING_STATE_IN_USE) {
+            continue;
+        }
+        int totals[RESOURCE_MAX];
+        count_space_resources(b, totals, 0);
+        for (int r = 0; r < RESOURCE_MAX; r++) {
+            if (b->resources[r] != totals[r]) {
+                log_error("Warehouse resource totals do not match its spaces, warehouse id:", 0, b->id);
+                log_error("First mismatching resource:", 0, r);
+                mismatches++;
+                break;
+            }
+        }
+    }
+    return mismatches;
+}
+
+static void update_main_resources(building *space, int resource, int amount)
+{
+    // The main warehouse keeps the totals of its spaces up to date, so they do not have to be recounted
+    if (resource > RESOURCE_NONE && resource < RESOURCE_MAX) {
+        building *main = building_main(space);
+        main->resources[resource] += amount;
+        main->resources[RESOURCE_NONE] -= amount;
     }
-    main->resources[RESOURCE_NONE] = BUILDING_STORAGE_QUANTITY_MAX - total_loads;
 }
 
 int building_warehouse_try_add_resource(building *b, int resource, int quantity, int respect_settings)
@@ -193,6 +239,7 @@ int building_warehouse_try_add_resource(building *b, int resource, int quantity,
 
         space->resources[resource] += to_add;
         space->subtype.warehouse_resource_id = resource;
+        update_main_resources(space, resource, to_add);
         added += to_add;
 
         city_resource_add_to_warehouse(resource, to_add);
@@ -248,11 +295,13 @@ int building_warehouse_try_remove_resource(building *warehouse, int resource, in
         if (space->resources[resource] > remaining_desired) {
             removed_amount += remaining_desired;
             city_resource_remove_from_warehouse(resource, remaining_desired);
+            update_main_resources(space, resource, -remaining_desired);
             space->resources[resource] -= remaining_desired;
             remaining_desired = 0;
         } else {
             removed_amount += space->resources[resource];
             city_resource_remove_from_warehouse(resource, space->resources[resource]);
+            update_main_resources(space, resource, -space->resources[resource]);
             remaining_desired -= space->resources[resource];
             space->resources[resource] = 0;
             space->subtype.warehouse_resource_id = RESOURCE_NONE;
@@ -277,10 +326,12 @@ void building_warehouse_remove_resource_curse(building *warehouse, int amount)
         }
         if (space->resources[resource] > amount) {
             city_resource_remove_from_warehouse(resource, amount);
+            update_main_resources(space, resource, -amount);
             space->resources[resource] -= amount;
             amount = 0;
         } else {
             city_resource_remove_from_warehouse(resource, space->resources[resource]);
+            update_main_resources(space, resource, -space->resources[resource]);
             amount -= space->resources[resource];
             space->resources[resource] = 0;
             space->subtype.warehouse_resource_id = RESOURCE_NONE;
@@ -431,7 +482,6 @@ static int building_warehouse_max_space_for_resource(building *b, int resource)
 
 int building_warehouse_maximum_receptible_amount(building *b, int resource)
 {
-    building_warehouse_recount_resources(b);
     if (b->has_plague || building_storage_get_empty_all(b->id) ||
          b->state != BUILDING_STATE_IN_USE || b->resources[RESOURCE_NONE] <= 0) {
         return 0;
@@ -701,7 +751,6 @@ int building_warehouse_determine_worker_task(building *warehouse, int *resource)
     if (pct_workers < 50) {
         return WAREHOUSE_TASK_NONE;
     }
-    building_warehouse_recount_resources(warehouse);
     building *space;
     //TASK 1: emptying takes priority
     if (building_storage_get_empty_all(warehouse->id)) {
@@ -250,6 +250,17 @@ int building_warehouse_determine_worker_task(building *warehouse, int *resource)
   */
 void building_warehouse_recount_resources(building *main);
 
+ /**
+  * @brief Recount resources for all warehouses, needed when the totals cannot be trusted, e.g. after loading.
+  */
+void building_warehouses_recount_resources(void);
+
+ /**
+  * @brief Check the resource totals kept by all warehouses against their spaces, logging every mismatch.
+  * @return number of warehouses whose totals do not match
+  */
+int building_warehouses_check_resources(void);
+
 /*----------------------*
  * Requests to Rome
  *----------------------*/
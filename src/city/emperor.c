@@ -8,6 +8,7 @@
 #include "figure/formation.h"
 #include "game/campaign.h"
 #include "game/difficulty.h"
+#include "game/replay.h"
 #include "game/time.h"
 #include "scenario/property.h"
 #include "scenario/invasion.h"
@@ -180,6 +181,7 @@ void city_emperor_update(void)
 
 void city_emperor_init_selected_gift(void)
 {
+    game_replay_record_command(REPLAY_COMMAND_INIT_SELECTED_GIFT, 0, 0, 0);
     if (city_data.emperor.selected_gift_size == GIFT_LAVISH && !city_emperor_can_send_gift(GIFT_LAVISH)) {
         city_data.emperor.selected_gift_size = GIFT_GENEROUS;
     }
@@ -190,6 +192,7 @@ void city_emperor_init_selected_gift(void)
 
 int city_emperor_set_gift_size(int size)
 {
+    game_replay_record_command(REPLAY_COMMAND_SET_GIFT_SIZE, size, 0, 0);
     if (city_data.emperor.gifts[size].cost <= city_data.emperor.personal_savings) {
         city_data.emperor.selected_gift_size = size;
         return 1;
@@ -232,6 +235,7 @@ void city_emperor_send_gift(void)
     if (cost > city_data.emperor.personal_savings) {
         return;
     }
+    game_replay_record_command(REPLAY_COMMAND_SEND_GIFT, 0, 0, 0);
 
     if (city_data.emperor.gift_overdose_penalty <= 0) {
         city_data.emperor.gift_overdose_penalty = 1;
@@ -345,6 +349,7 @@ void city_emperor_init_donation_amount(void)
 
 void city_emperor_set_donation_amount(int amount)
 {
+    game_replay_record_command(REPLAY_COMMAND_SET_DONATION_AMOUNT, amount, 0, 0);
     city_data.emperor.donate_amount = calc_bound(amount, 0, city_data.emperor.personal_savings - city_data.games.bet_amount);
 }
 
@@ -355,6 +360,7 @@ void city_emperor_change_donation_amount(int change)
 
 void city_emperor_donate_savings_to_city(void)
 {
+    game_replay_record_command(REPLAY_COMMAND_DONATE, 0, 0, 0);
     city_finance_process_donation(city_data.emperor.donate_amount);
     city_data.emperor.personal_savings -= city_data.emperor.donate_amount;
     city_finance_calculate_totals();
@@ -10,6 +10,7 @@
 #include "city/message.h"
 #include "city/sentiment.h"
 #include "core/config.h"
+#include "game/replay.h"
 #include "game/time.h"
 
 auto_festival autofestivals[5] = {
@@ -62,6 +63,7 @@ int city_festival_selected_god(void)
 
 void city_festival_select_god(int god_id)
 {
+    game_replay_record_command(REPLAY_COMMAND_SELECT_FESTIVAL_GOD, god_id, 0, 0);
     city_data.festival.selected.god = god_id;
 }
 
@@ -124,6 +126,7 @@ int city_festival_games_cooldown(void)
 
 int city_festival_select_size(int size)
 {
+    game_replay_record_command(REPLAY_COMMAND_SELECT_FESTIVAL_SIZE, size, 0, 0);
     if (size == FESTIVAL_GRAND && city_data.festival.not_enough_wine) {
         return 0;
     }
@@ -133,6 +136,7 @@ int city_festival_select_size(int size)
 
 void city_festival_schedule(void)
 {
+    game_replay_record_command(REPLAY_COMMAND_SCHEDULE_FESTIVAL, 0, 0, 0);
     city_data.festival.planned.god = city_data.festival.selected.god;
     city_data.festival.planned.size = city_data.festival.selected.size;
     int cost;
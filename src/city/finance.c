@@ -10,6 +10,7 @@
 #include "core/calc.h"
 #include "core/random.h"
 #include "game/difficulty.h"
+#include "game/replay.h"
 #include "game/time.h"
 #include "figuretype/entertainer.h"
 #include "map/data.h"
@@ -95,6 +96,7 @@ int city_finance_tax_percentage(void)
 
 void city_finance_change_tax_percentage(int change)
 {
+    game_replay_record_command(REPLAY_COMMAND_CHANGE_TAX, change, 0, 0);
     city_finance_set_tax_percentage(city_data.finance.tax_percentage + change);
 }
 
@@ -11,6 +11,7 @@
 #include "city/message.h"
 #include "city/sentiment.h"
 #include "core/config.h"
+#include "game/replay.h"
 #include "game/time.h"
 
 #define POPULATION_SCALING_FACTOR 1200
@@ -115,6 +116,8 @@ static void end_games(void)
 
 void city_games_schedule(int game_id)
 {
+    game_replay_record_command(REPLAY_COMMAND_SCHEDULE_GAMES, game_id, 0, 0);
+    city_data.games.selected_games_id = game_id;
     games_type *game = city_games_get_game_type(game_id);
     city_emperor_decrement_personal_savings(city_games_money_cost(game_id));
 
@@ -10,6 +10,7 @@
 #include "city/population.h"
 #include "core/calc.h"
 #include "core/random.h"
+#include "game/replay.h"
 #include "game/time.h"
 #include "scenario/data.h"
 #include "scenario/property.h"
@@ -173,6 +174,7 @@ int city_labor_wages(void)
 
 void city_labor_change_wages(int amount)
 {
+    game_replay_record_command(REPLAY_COMMAND_CHANGE_WAGES, amount, 0, 0);
     city_data.labor.wages += amount;
     city_data.labor.wages = calc_bound(city_data.labor.wages, 0, 100);
 }
@@ -277,21 +279,31 @@ static void calculate_workers_needed_per_category(void)
         city_data.labor.categories[cat].workers_allocated = 0;
         city_data.labor.categories[cat].workers_needed = 0;
     }
-    for (int i = 1; i < building_count(); i++) {
-        building *b = building_get(i);
-        if (b->state != BUILDING_STATE_IN_USE) {
+    for (building_type type = 0; type < BUILDING_TYPE_MAX; type++) {
+        int category = CATEGORY_FOR_BUILDING_TYPE[type];
+        if (category == LABOR_CATEGORY_NONE) {
+            // The category is saved with the building, so it is still reset for buildings that do not employ workers
+            for (building *b = building_first_of_type(type); b; b = b->next_of_type) {
+                if (b->state == BUILDING_STATE_IN_USE) {
+                    b->labor_category = category - 1;
+                }
+            }
             continue;
         }
-        int category = CATEGORY_FOR_BUILDING_TYPE[b->type];
-        b->labor_category = category - 1;
-        if (!should_have_workers(b, category, 1)) {
-            continue;
+        int laborers = building_get_laborers(type);
+        labor_category_data *category_data = &city_data.labor.categories[category - 1];
+        for (building *b = building_first_of_type(type); b; b = b->next_of_type) {
+            if (b->state != BUILDING_STATE_IN_USE) {
+                continue;
+            }
+            b->labor_category = category - 1;
+            if (!should_have_workers(b, category, 1)) {
+                continue;
+            }
+            category_data->workers_needed += laborers;
+            category_data->total_houses_covered += b->houses_covered;
+            category_data->buildings++;
         }
-
-        city_data.labor.categories[category - 1].workers_needed += building_get_laborers(b->type);
-
-        city_data.labor.categories[category - 1].total_houses_covered += b->houses_covered;
-        city_data.labor.categories[category - 1].buildings++;
     }
 }
 
@@ -390,29 +402,23 @@ static void check_employment(void)
     }
 }
 
-static void set_building_worker_weight(void)
+static void allocate_workers_to_water_building(building *b, int water_per_10k_per_building,
+    int percentage_not_filled, int workers_per_building, int *buildings_to_skip, int *start_building_id)
 {
-    int water_per_10k_per_building = calc_percentage(100, city_data.labor.categories[LABOR_CATEGORY_WATER - 1].buildings);
-    for (building_type type = 0; type < BUILDING_TYPE_MAX; type++) {
-        int cat = CATEGORY_FOR_BUILDING_TYPE[type];
-        if (cat == LABOR_CATEGORY_NONE) {
-            continue;
-        }
-        for (building *b = building_first_of_type(type); b; b = b->next_of_type) {
-            if (b->state != BUILDING_STATE_IN_USE) {
-                continue;
-            }
-            if (cat == LABOR_CATEGORY_WATER) {
-                b->percentage_houses_covered = water_per_10k_per_building;
+    b->percentage_houses_covered = water_per_10k_per_building;
+    b->num_workers = 0;
+    if (b->percentage_houses_covered > 0) {
+        if (percentage_not_filled > 0) {
+            if (*buildings_to_skip) {
+                --*buildings_to_skip;
+            } else if (*start_building_id) {
+                b->num_workers = workers_per_building;
             } else {
-                b->percentage_houses_covered = 0;
-                
-                if (b->houses_covered) {
-                    b->percentage_houses_covered =
-                        calc_percentage(100 * b->houses_covered,
-                        city_data.labor.categories[cat - 1].total_houses_covered);
-                }
+                *start_building_id = b->id;
+                b->num_workers = workers_per_building;
             }
+        } else {
+            b->num_workers = building_get_laborers(b->type);
         }
     }
 }
@@ -422,6 +428,8 @@ static void allocate_workers_to_water(void)
     static int start_building_id = 1;
     labor_category_data *water_cat = &city_data.labor.categories[LABOR_CATEGORY_WATER - 1];
 
+    int water_per_10k_per_building = calc_percentage(100, water_cat->buildings);
+
     int percentage_not_filled = 100 - calc_percentage(water_cat->workers_allocated, water_cat->workers_needed);
 
     int buildings_to_skip = calc_adjust_with_percentage(water_cat->buildings, percentage_not_filled);
@@ -432,30 +440,17 @@ static void allocate_workers_to_water(void)
     } else {
         workers_per_building = water_cat->workers_allocated / (water_cat->buildings - buildings_to_skip);
     }
-    int building_id = start_building_id;
+    int first_building_id = start_building_id;
     start_building_id = 0;
-    for (int guard = 1; guard < building_count(); guard++, building_id++) {
-        if (building_id >= building_count()) {
-            building_id = 1;
-        }
-        building *b = building_get(building_id);
-        if (b->state != BUILDING_STATE_IN_USE || CATEGORY_FOR_BUILDING_TYPE[b->type] != LABOR_CATEGORY_WATER) {
-            continue;
-        }
-        b->num_workers = 0;
-        if (b->percentage_houses_covered > 0) {
-            if (percentage_not_filled > 0) {
-                if (buildings_to_skip) {
-                    --buildings_to_skip;
-                } else if (start_building_id) {
-                    b->num_workers = workers_per_building;
-                } else {
-                    start_building_id = building_id;
-                    b->num_workers = workers_per_building;
-                }
-            } else {
-                b->num_workers = building_get_laborers(b->type);
+    // Fountains are the only water buildings. Their list is sorted by id, so walk it twice to visit them
+    // in id order, starting at the building where the workers ran out the last time
+    for (int wrapped = 0; wrapped < 2; wrapped++) {
+        for (building *b = building_first_of_type(BUILDING_FOUNTAIN); b; b = b->next_of_type) {
+            if (b->state != BUILDING_STATE_IN_USE || ((int) b->id < first_building_id) != wrapped) {
+                continue;
             }
+            allocate_workers_to_water_building(b, water_per_10k_per_building, percentage_not_filled,
+                workers_per_building, &buildings_to_skip, &start_building_id);
         }
     }
     if (!start_building_id) {
@@ -484,6 +479,11 @@ static void allocate_workers_to_non_water_buildings(void)
             if (b->state != BUILDING_STATE_IN_USE) {
                 continue;
             }
+            b->percentage_houses_covered = 0;
+            if (b->houses_covered) {
+                b->percentage_houses_covered =
+                    calc_percentage(100 * b->houses_covered, city_data.labor.categories[cat - 1].total_houses_covered);
+            }
             b->num_workers = 0;
             if (b->type != BUILDING_LATRINES && (!should_have_workers(b, cat, 0) || b->percentage_houses_covered <= 0)) {
                 continue;
@@ -547,7 +547,6 @@ static void allocate_workers_to_non_water_buildings(void)
 
 static void allocate_workers_to_buildings(void)
 {
-    set_building_worker_weight();
     allocate_workers_to_water();
     allocate_workers_to_non_water_buildings();
 }
@@ -567,6 +566,7 @@ void city_labor_update(void)
 
 void city_labor_set_priority(int category, int new_priority)
 {
+    game_replay_record_command(REPLAY_COMMAND_SET_LABOR_PRIORITY, category, new_priority, 0);
     int old_priority = city_data.labor.categories[category].priority;
     if (old_priority == new_priority) {
         return;
@@ -10,6 +10,7 @@
 #include "empire/city.h"
 #include "figure/formation.h"
 #include "figure/formation_legion.h"
+#include "game/replay.h"
 #include "scenario/distant_battle.h"
 
 void city_military_clear_legionary_legions(void)
@@ -49,6 +50,7 @@ int city_military_empire_service_legions(void)
 
 void city_military_clear_empire_service_legions(void)
 {
+    game_replay_record_command(REPLAY_COMMAND_CLEAR_EMPIRE_SERVICE, 0, 0, 0);
     city_data.military.empire_service_legions = 0;
 }
 
@@ -6,6 +6,7 @@
 #include "core/calc.h"
 #include "core/config.h"
 #include "core/random.h"
+#include "game/replay.h"
 
 static const int BIRTHS_PER_AGE_DECENNIUM[10] = {
     0, 3, 16, 9, 2, 0, 0, 0, 0, 0
@@ -422,6 +423,7 @@ int city_population_graph_order(void)
 
 void city_population_set_graph_order(int graph_order)
 {
+    game_replay_record_command(REPLAY_COMMAND_SET_GRAPH_ORDER, graph_order, 0, 0);
     city_data.population.graph_order = graph_order;
 }
 
@@ -1,6 +1,7 @@
 #include "city/data_private.h"
 #include "city/warning.h"
 #include "core/random.h"
+#include "game/replay.h"
 #include "festival.h"
 #include "race_bet.h"
 
@@ -14,6 +15,13 @@ int has_bet_in_progress(void)
     return city_data.games.chosen_horse != NO_BET && city_data.games.bet_amount;
 }
 
+void city_race_bet_place(int horse, int amount)
+{
+    game_replay_record_command(REPLAY_COMMAND_PLACE_RACE_BET, horse, amount, 0);
+    city_data.games.chosen_horse = horse;
+    city_data.games.bet_amount = amount;
+}
+
 void race_result_process(void)
 {
     if (city_data.games.chosen_horse != NO_BET) {
@@ -10,6 +10,7 @@ typedef enum {
 } bet_horse;
 
 int has_bet_in_progress(void);
+void city_race_bet_place(int horse, int amount);
 void race_result_process(void);
 
 #endif //CITY_RACE_BET_H
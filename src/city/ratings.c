@@ -11,6 +11,7 @@
 #include "core/calc.h"
 #include "core/config.h"
 #include "game/difficulty.h"
+#include "game/replay.h"
 #include "game/time.h"
 #include "scenario/criteria.h"
 #include "scenario/property.h"
@@ -45,6 +46,7 @@ selected_rating city_rating_selected(void)
 
 void city_rating_select(selected_rating rating)
 {
+    game_replay_record_command(REPLAY_COMMAND_SELECT_RATING, rating, 0, 0);
     city_data.ratings.selected = rating;
 }
 
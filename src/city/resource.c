@@ -21,6 +21,7 @@
 #include "figure/formation.h"
 #include "game/cheats.h"
 #include "game/difficulty.h"
+#include "game/replay.h"
 #include "game/resource.h"
 #include "game/tutorial.h"
 #include "map/road_access.h"
@@ -205,6 +206,7 @@ resource_trade_status city_resource_trade_status(resource_type resource)
 
 void city_resource_cycle_trade_status(resource_type resource, resource_trade_status status)
 {
+    game_replay_record_command(REPLAY_COMMAND_CYCLE_TRADE_STATUS, resource, status, 0);
     if (status == TRADE_STATUS_IMPORT && !empire_can_import_resource(resource)) {
         city_data.resource.trade_status[resource] &= ~TRADE_STATUS_IMPORT;
         return;
@@ -227,6 +229,7 @@ int city_resource_import_over(resource_type resource)
 
 void city_resource_change_import_over(resource_type resource, int change)
 {
+    game_replay_record_command(REPLAY_COMMAND_CHANGE_IMPORT_OVER, resource, change, 0);
     city_data.resource.import_over[resource] = calc_bound(city_data.resource.import_over[resource] + change, 0, 100);
 }
 
@@ -237,6 +240,7 @@ int city_resource_export_over(resource_type resource)
 
 void city_resource_change_export_over(resource_type resource, int change)
 {
+    game_replay_record_command(REPLAY_COMMAND_CHANGE_EXPORT_OVER, resource, change, 0);
     city_data.resource.export_over[resource] = calc_bound(city_data.resource.export_over[resource] + change, 0, 100);
 }
 
@@ -247,6 +251,7 @@ int city_resource_is_stockpiled(resource_type resource)
 
 void city_resource_toggle_stockpiled(resource_type resource)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_STOCKPILED, resource, 0, 0);
     if (city_data.resource.stockpiled[resource]) {
         city_data.resource.stockpiled[resource] = 0;
         city_data.resource.trade_status[resource] |= city_data.resource.export_status_before_stockpiling[resource];
@@ -264,6 +269,7 @@ int city_resource_is_mothballed(resource_type resource)
 
 void city_resource_toggle_mothballed(resource_type resource)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_MOTHBALLED, resource, 0, 0);
     city_data.resource.mothballed[resource] = city_data.resource.mothballed[resource] ? 0 : 1;
 }
 
@@ -6,6 +6,7 @@
 #include "city/finance.h"
 #include "city/message.h"
 #include "core/config.h"
+#include "game/replay.h"
 #include "game/time.h"
 #include "scenario/criteria.h"
 #include "scenario/property.h"
@@ -159,6 +160,7 @@ void city_victory_update_months_to_govern(void)
 
 void city_victory_continue_governing(int months)
 {
+    game_replay_record_command(REPLAY_COMMAND_CONTINUE_GOVERNING, months, 0, 0);
     city_data.mission.victory_message_shown = 0;
     city_data.mission.has_won = 1;
     city_data.mission.continue_months_left += months;
@@ -170,6 +172,7 @@ void city_victory_continue_governing(int months)
 
 void city_victory_stop_governing(void)
 {
+    game_replay_record_command(REPLAY_COMMAND_STOP_GOVERNING, 0, 0, 0);
     city_data.mission.has_won = 0;
     city_data.mission.continue_months_left = 0;
     city_data.mission.continue_months_chosen = 0;
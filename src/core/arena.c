@@ -0,0 +1,104 @@
+#include "core/arena.h"
+
+#include "core/log.h"
+
+#include <stdlib.h>
+
+#define MIN_BLOCK_SIZE (256 * 1024)
+#define ALIGNMENT 16
+
+typedef struct arena_block {
+    struct arena_block *next;
+    size_t size;
+    size_t used;
+} arena_block;
+
+typedef struct {
+    arena_block *blocks;
+} arena;
+
+static struct {
+    arena arenas[ARENA_LIFETIME_MAX];
+    int tick_running;
+} data;
+
+static size_t align(size_t size)
+{
+    return (size + ALIGNMENT - 1) & ~((size_t) ALIGNMENT - 1);
+}
+
+static unsigned char *block_memory(arena_block *block)
+{
+    return (unsigned char *) block + align(sizeof(arena_block));
+}
+
+static arena_block *create_block(size_t size, arena_block *next)
+{
+    arena_block *block = malloc(align(sizeof(arena_block)) + size);
+    if (!block) {
+        return 0;
+    }
+    block->next = next;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+static void release(arena *a)
+{
+    if (!a->blocks || !a->blocks->next) {
+        if (a->blocks) {
+            a->blocks->used = 0;
+        }
+        return;
+    }
+    // More than one block was needed: replace them by a single block that fits everything
+    size_t total = 0;
+    arena_block *block = a->blocks;
+    while (block) {
+        arena_block *next = block->next;
+        total += block->size;
+        free(block);
+        block = next;
+    }
+    a->blocks = create_block(total, 0);
+}
+
+void arena_begin(arena_lifetime lifetime)
+{
+    release(&data.arenas[lifetime]);
+    if (lifetime == ARENA_LIFETIME_TICK) {
+        data.tick_running = 1;
+    }
+}
+
+void arena_end(arena_lifetime lifetime)
+{
+    if (lifetime == ARENA_LIFETIME_TICK) {
+        data.tick_running = 0;
+    }
+}
+
+static arena *current_arena(void)
+{
+    return &data.arenas[data.tick_running ? ARENA_LIFETIME_TICK : ARENA_LIFETIME_FRAME];
+}
+
+void *arena_alloc(size_t size)
+{
+    arena *a = current_arena();
+    size = align(size);
+    arena_block *block = a->blocks;
+    if (!block || block->size - block->used < size) {
+        size_t block_size = size > MIN_BLOCK_SIZE ? size : MIN_BLOCK_SIZE;
+        block = create_block(block_size, a->blocks);
+        if (!block) {
+            log_error("Unable to allocate scratch memory of size", 0, (int) size);
+            return 0;
+        }
+        a->blocks = block;
+    }
+    void *memory = block_memory(block) + block->used;
+    block->used += size;
+    return memory;
+}
@@ -0,0 +1,40 @@
+#ifndef CORE_ARENA_H
+#define CORE_ARENA_H
+
+#include <stddef.h>
+
+/**
+ * @file
+ * Scratch memory that is released all at once at the start of the next frame or game tick.
+ *
+ * Memory taken from the arena must not be freed and must not be kept beyond the current frame or tick.
+ */
+
+typedef enum {
+    ARENA_LIFETIME_FRAME = 0,
+    ARENA_LIFETIME_TICK = 1,
+    ARENA_LIFETIME_MAX
+} arena_lifetime;
+
+/**
+ * Starts a new frame or tick, releasing all memory that was taken during the previous one.
+ * Memory taken while a tick is running comes from the tick arena, otherwise it comes from the frame arena.
+ * @param lifetime The lifetime that starts
+ */
+void arena_begin(arena_lifetime lifetime);
+
+/**
+ * Ends the tick, further memory will come from the frame arena.
+ * Memory taken during the tick stays valid until the next tick begins.
+ * @param lifetime The lifetime that ends
+ */
+void arena_end(arena_lifetime lifetime);
+
+/**
+ * Takes memory from the current arena
+ * @param size Size in bytes
+ * @return Pointer to the memory, aligned for any type, or 0 when out of memory
+ */
+void *arena_alloc(size_t size);
+
+#endif // CORE_ARENA_H
@@ -31,53 +31,62 @@ static int check_size(buffer *buf, size_t size)
     return 1;
 }
 
+int buffer_reserve(buffer *buf, size_t size)
+{
+    return check_size(buf, size);
+}
+
+// The reads go through a local pointer and the index is updated once,
+// because the compiler could otherwise reload the buffer after every byte
+static uint16_t read_le16(const uint8_t *data)
+{
+    return (uint16_t) (data[0] | (data[1] << 8));
+}
+
+static uint32_t read_le32(const uint8_t *data)
+{
+    return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
 void buffer_write_u8(buffer *buf, uint8_t value)
 {
     if (check_size(buf, 1)) {
-        buf->data[buf->index++] = value;
+        buffer_write_u8_unchecked(buf, value);
     }
 }
 
 void buffer_write_u16(buffer *buf, uint16_t value)
 {
     if (check_size(buf, 2)) {
-        buf->data[buf->index++] = value & 0xff;
-        buf->data[buf->index++] = (value >> 8) & 0xff;
+        buffer_write_u16_unchecked(buf, value);
     }
 }
 
 void buffer_write_u32(buffer *buf, uint32_t value)
 {
     if (check_size(buf, 4)) {
-        buf->data[buf->index++] = value & 0xff;
-        buf->data[buf->index++] = (value >> 8) & 0xff;
-        buf->data[buf->index++] = (value >> 16) & 0xff;
-        buf->data[buf->index++] = (value >> 24) & 0xff;
+        buffer_write_u32_unchecked(buf, value);
     }
 }
 
 void buffer_write_i8(buffer *buf, int8_t value)
 {
     if (check_size(buf, 1)) {
-        buf->data[buf->index++] = value & 0xff;
+        buffer_write_i8_unchecked(buf, value);
     }
 }
 
 void buffer_write_i16(buffer *buf, int16_t value)
 {
     if (check_size(buf, 2)) {
-        buf->data[buf->index++] = value & 0xff;
-        buf->data[buf->index++] = (value >> 8) & 0xff;
+        buffer_write_i16_unchecked(buf, value);
     }
 }
 
 void buffer_write_i32(buffer *buf, int32_t value)
 {
     if (check_size(buf, 4)) {
-        buf->data[buf->index++] = value & 0xff;
-        buf->data[buf->index++] = (value >> 8) & 0xff;
-        buf->data[buf->index++] = (value >> 16) & 0xff;
-        buf->data[buf->index++] = (value >> 24) & 0xff;
+        buffer_write_i32_unchecked(buf, value);
     }
 }
 
@@ -101,9 +110,9 @@ uint8_t buffer_read_u8(buffer *buf)
 uint16_t buffer_read_u16(buffer *buf)
 {
     if (check_size(buf, 2)) {
-        uint8_t b0 = buf->data[buf->index++];
-        uint8_t b1 = buf->data[buf->index++];
-        return (uint16_t) (b0 | (b1 << 8));
+        uint16_t value = read_le16(&buf->data[buf->index]);
+        buf->index += 2;
+        return value;
     } else {
         return 0;
     }
@@ -112,11 +121,9 @@ uint16_t buffer_read_u16(buffer *buf)
 uint32_t buffer_read_u32(buffer *buf)
 {
     if (check_size(buf, 4)) {
-        uint8_t b0 = buf->data[buf->index++];
-        uint8_t b1 = buf->data[buf->index++];
-        uint8_t b2 = buf->data[buf->index++];
-        uint8_t b3 = buf->data[buf->index++];
-        return (uint32_t) (b0 | (b1 << 8) | (b2 << 16) | (b3 << 24));
+        uint32_t value = read_le32(&buf->data[buf->index]);
+        buf->index += 4;
+        return value;
     } else {
         return 0;
     }
@@ -134,9 +141,9 @@ int8_t buffer_read_i8(buffer *buf)
 int16_t buffer_read_i16(buffer *buf)
 {
     if (check_size(buf, 2)) {
-        uint16_t b0 = buf->data[buf->index++];
-        uint16_t b1 = buf->data[buf->index++];
-        return (int16_t) (b0 | (b1 << 8));
+        int16_t value = (int16_t) read_le16(&buf->data[buf->index]);
+        buf->index += 2;
+        return value;
     } else {
         return 0;
     }
@@ -145,11 +152,9 @@ int16_t buffer_read_i16(buffer *buf)
 int32_t buffer_read_i32(buffer *buf)
 {
     if (check_size(buf, 4)) {
-        uint32_t b0 = buf->data[buf->index++];
-        uint32_t b1 = buf->data[buf->index++];
-        uint32_t b2 = buf->data[buf->index++];
-        uint32_t b3 = buf->data[buf->index++];
-        return (int32_t) (b0 | (b1 << 8) | (b2 << 16) | (b3 << 24));
+        int32_t value = (int32_t) read_le32(&buf->data[buf->index]);
+        buf->index += 4;
+        return value;
     } else {
         return 0;
     }
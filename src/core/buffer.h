@@ -90,6 +90,88 @@ void buffer_write_i32(buffer *buffer, int32_t value);
  */
 void buffer_write_raw(buffer *buffer, const void *value, size_t size);
 
+/**
+ * Checks that a record of the given size can be written to the buffer.
+ * If it can, the buffer_write_*_unchecked functions may be used for the record.
+ * @param buffer Buffer
+ * @param size Size of the record in bytes
+ * @return 1 if the record fits, 0 if it does not. In that case the overflow flag is set.
+ */
+int buffer_reserve(buffer *buffer, size_t size);
+
+// The unchecked writers do not check the size of the buffer, so they must only be used
+// after a successful buffer_reserve call for all of the bytes they write.
+// The bytes are stored through a local pointer and the index is updated once,
+// because stores through the data pointer could otherwise change the buffer itself.
+
+/**
+ * Writes an unsigned 8-bit integer without checking the buffer size
+ * @param buf Buffer
+ * @param value Value to write
+ */
+static inline void buffer_write_u8_unchecked(buffer *buf, uint8_t value)
+{
+    buf->data[buf->index++] = value;
+}
+
+/**
+ * Writes an unsigned 16-bit integer without checking the buffer size
+ * @param buf Buffer
+ * @param value Value to write
+ */
+static inline void buffer_write_u16_unchecked(buffer *buf, uint16_t value)
+{
+    uint8_t *data = &buf->data[buf->index];
+    data[0] = value & 0xff;
+    data[1] = (value >> 8) & 0xff;
+    buf->index += 2;
+}
+
+/**
+ * Writes an unsigned 32-bit integer without checking the buffer size
+ * @param buf Buffer
+ * @param value Value to write
+ */
+static inline void buffer_write_u32_unchecked(buffer *buf, uint32_t value)
+{
+    uint8_t *data = &buf->data[buf->index];
+    data[0] = value & 0xff;
+    data[1] = (value >> 8) & 0xff;
+    data[2] = (value >> 16) & 0xff;
+    data[3] = (value >> 24) & 0xff;
+    buf->index += 4;
+}
+
+/**
+ * Writes a signed 8-bit integer without checking the buffer size
+ * @param buf Buffer
+ * @param value Value to write
+ */
+static inline void buffer_write_i8_unchecked(buffer *buf, int8_t value)
+{
+    buffer_write_u8_unchecked(buf, (uint8_t) value);
+}
+
+/**
+ * Writes a signed 16-bit integer without checking the buffer size
+ * @param buf Buffer
+ * @param value Value to write
+ */
+static inline void buffer_write_i16_unchecked(buffer *buf, int16_t value)
+{
+    buffer_write_u16_unchecked(buf, (uint16_t) value);
+}
+
+/**
+ * Writes a signed 32-bit integer without checking the buffer size
+ * @param buf Buffer
+ * @param value Value to write
+ */
+static inline void buffer_write_i32_unchecked(buffer *buf, int32_t value)
+{
+    buffer_write_u32_unchecked(buf, (uint32_t) value);
+}
+
 /**
  * Reads an unsigned 8-bit integer
  * @param buffer Buffer
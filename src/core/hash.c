@@ -0,0 +1,149 @@
+#include "core/hash.h"
+
+#include <string.h>
+
+#define PRIME_1 0x9E3779B185EBCA87ULL
+#define PRIME_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME_3 0x165667B19E3779F9ULL
+#define PRIME_4 0x85EBCA77C2B2AE63ULL
+#define PRIME_5 0x27D4EB2F165667C5ULL
+
+static uint64_t rotate_left(uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// Reads are always little endian so the hash is the same on every platform
+static uint64_t read_u64(const uint8_t *data)
+{
+    return (uint64_t) data[0] | (uint64_t) data[1] << 8 | (uint64_t) data[2] << 16 | (uint64_t) data[3] << 24 |
+        (uint64_t) data[4] << 32 | (uint64_t) data[5] << 40 | (uint64_t) data[6] << 48 | (uint64_t) data[7] << 56;
+}
+
+static uint32_t read_u32(const uint8_t *data)
+{
+    return (uint32_t) data[0] | (uint32_t) data[1] << 8 | (uint32_t) data[2] << 16 | (uint32_t) data[3] << 24;
+}
+
+static uint64_t round_lane(uint64_t lane, uint64_t input)
+{
+    lane += input * PRIME_2;
+    lane = rotate_left(lane, 31);
+    return lane * PRIME_1;
+}
+
+static uint64_t merge_lane(uint64_t hash, uint64_t lane)
+{
+    hash ^= round_lane(0, lane);
+    return hash * PRIME_1 + PRIME_4;
+}
+
+static void consume_stripes(uint64_t *lanes, const uint8_t *data, size_t stripes)
+{
+    // The four lanes are independent, which allows the compiler to interleave or vectorize them
+    uint64_t l0 = lanes[0];
+    uint64_t l1 = lanes[1];
+    uint64_t l2 = lanes[2];
+    uint64_t l3 = lanes[3];
+    for (size_t i = 0; i < stripes; i++, data += HASH_STRIPE_SIZE) {
+        l0 = round_lane(l0, read_u64(data));
+        l1 = round_lane(l1, read_u64(data + 8));
+        l2 = round_lane(l2, read_u64(data + 16));
+        l3 = round_lane(l3, read_u64(data + 24));
+    }
+    lanes[0] = l0;
+    lanes[1] = l1;
+    lanes[2] = l2;
+    lanes[3] = l3;
+}
+
+void hash_init(hash_state *state, uint64_t seed)
+{
+    state->lanes[0] = seed + PRIME_1 + PRIME_2;
+    state->lanes[1] = seed + PRIME_2;
+    state->lanes[2] = seed;
+    state->lanes[3] = seed - PRIME_1;
+    state->total_length = 0;
+    state->stripe_length = 0;
+    state->seed = seed;
+}
+
+void hash_update(hash_state *state, const void *data, size_t length)
+{
+    const uint8_t *input = data;
+    state->total_length += length;
+
+    if (state->stripe_length) {
+        size_t missing = HASH_STRIPE_SIZE - state->stripe_length;
+        if (length < missing) {
+            memcpy(state->stripe + state->stripe_length, input, length);
+            state->stripe_length += length;
+            return;
+        }
+        memcpy(state->stripe + state->stripe_length, input, missing);
+        consume_stripes(state->lanes, state->stripe, 1);
+        input += missing;
+        length -= missing;
+        state->stripe_length = 0;
+    }
+    size_t stripes = length / HASH_STRIPE_SIZE;
+    consume_stripes(state->lanes, input, stripes);
+    input += stripes * HASH_STRIPE_SIZE;
+    length -= stripes * HASH_STRIPE_SIZE;
+
+    memcpy(state->stripe, input, length);
+    state->stripe_length = length;
+}
+
+uint64_t hash_digest(const hash_state *state)
+{
+    uint64_t hash;
+    if (state->total_length >= HASH_STRIPE_SIZE) {
+        const uint64_t *lanes = state->lanes;
+        hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) +
+            rotate_left(lanes[2], 12) + rotate_left(lanes[3], 18);
+        hash = merge_lane(hash, lanes[0]);
+        hash = merge_lane(hash, lanes[1]);
+        hash = merge_lane(hash, lanes[2]);
+        hash = merge_lane(hash, lanes[3]);
+    } else {
+        hash = state->seed + PRIME_5;
+    }
+    hash += state->total_length;
+
+    const uint8_t *data = state->stripe;
+    size_t length = state->stripe_length;
+    while (length >= 8) {
+        hash ^= round_lane(0, read_u64(data));
+        hash = rotate_left(hash, 27) * PRIME_1 + PRIME_4;
+        data += 8;
+        length -= 8;
+    }
+    if (length >= 4) {
+        hash ^= (uint64_t) read_u32(data) * PRIME_1;
+        hash = rotate_left(hash, 23) * PRIME_2 + PRIME_3;
+        data += 4;
+        length -= 4;
+    }
+    while (length > 0) {
+        hash ^= *data * PRIME_5;
+        hash = rotate_left(hash, 11) * PRIME_1;
+        data++;
+        length--;
+    }
+
+    hash ^= hash >> 33;
+    hash *= PRIME_2;
+    hash ^= hash >> 29;
+    hash *= PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+uint64_t hash_data(const void *data, size_t length, uint64_t seed)
+{
+    hash_state state;
+    hash_init(&state, seed);
+    hash_update(&state, data, length);
+    return hash_digest(&state);
+}
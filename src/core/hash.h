@@ -0,0 +1,56 @@
+#ifndef CORE_HASH_H
+#define CORE_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file
+ * Fast non-cryptographic 64-bit hashing, following the XXH64 algorithm.
+ */
+
+#define HASH_STRIPE_SIZE 32
+
+/**
+ * Hashing state, to be able to hash data that comes in several pieces
+ */
+typedef struct {
+    uint64_t lanes[4];
+    uint64_t total_length;
+    uint8_t stripe[HASH_STRIPE_SIZE];
+    size_t stripe_length;
+    uint64_t seed;
+} hash_state;
+
+/**
+ * Starts a new hash
+ * @param state Hash state to initialize
+ * @param seed Seed for the hash
+ */
+void hash_init(hash_state *state, uint64_t seed);
+
+/**
+ * Adds data to the hash
+ * @param state Hash state
+ * @param data Data to add
+ * @param length Length of the data in bytes
+ */
+void hash_update(hash_state *state, const void *data, size_t length);
+
+/**
+ * Gets the hash of all data added so far
+ * @param state Hash state
+ * @return The hash value
+ */
+uint64_t hash_digest(const hash_state *state);
+
+/**
+ * Hashes a single block of data
+ * @param data Data to hash
+ * @param length Length of the data in bytes
+ * @param seed Seed for the hash
+ * @return The hash value
+ */
+uint64_t hash_data(const void *data, size_t length, uint64_t seed);
+
+#endif // CORE_HASH_H
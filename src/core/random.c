@@ -84,6 +84,12 @@ int32_t random_from_pool(int index)
     return data.pool[(data.pool_index + index) % MAX_RANDOM];
 }
 
+void random_get_state(uint32_t *iv1, uint32_t *iv2)
+{
+    *iv1 = data.iv1;
+    *iv2 = data.iv2;
+}
+
 void random_load_state(buffer *buf)
 {
     data.iv1 = buffer_read_u32(buf);
@@ -56,6 +56,13 @@ int16_t random_short_alt(void);
  */
 int32_t random_from_pool(int index);
 
+/**
+ * Gets the internal state of the generator, to compare two runs of the simulation
+ * @param iv1 First state value
+ * @param iv2 Second state value
+ */
+void random_get_state(uint32_t *iv1, uint32_t *iv2);
+
 /**
  * Save data to buffer
  * @param buf Buffer to save to
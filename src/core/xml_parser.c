@@ -8,6 +8,7 @@
 #include <string.h>
 
 #define XML_TOKENS_SIZE_STEP 128
+#define XML_FILE_CHUNK_SIZE 8192
 #define XML_ELEMENT_TEXT_BASE_LENGTH 64
 
 typedef struct {
@@ -30,6 +31,9 @@ static struct {
         unsigned int num_tokens;
         int line_number;
         unsigned int current_position;
+        unsigned int buffer_end;
+        int text_continues;
+        int at_line_start;
     } parser;
     struct {
         char *data;
@@ -255,15 +259,24 @@ static void handle_element_text(const sxmltok_t *token)
     if (data.current_element && data.current_element->on_text) {
         const char *text = data.buffer.data + token->startpos;
         int length = token->endpos - token->startpos;
+        // Text cut by the end of a chunk continues in the next one, so whether only spaces were found
+        // since the last line break must be kept until then
+        if (!data.parser.text_continues) {
+            data.parser.at_line_start = 1;
+        }
+        data.parser.text_continues = token->endpos == data.parser.buffer_end;
         while (length) {
             char *end = memchr(text, '\n', length);
             int line_length = end ? end - text + 1: length;
             length -= line_length;
             // Remove whitespace at beginning
-            while (*text == ' ' && line_length > 0) {
+            while (data.parser.at_line_start && line_length > 0 && *text == ' ') {
                 text++;
                 line_length--;
             }
+            if (line_length > 0) {
+                data.parser.at_line_start = text[line_length - 1] == '\n';
+            }
             append_to_text(&data.texts[data.depth], text, line_length);
             text += line_length;
         }
@@ -361,6 +374,9 @@ static void process_xml_tokens(const sxmltok_t *tokens, int num_tokens)
             default:
                 break;
         }
+        if (token->type != SXML_CDATA && token->type != SXML_CHARACTER) {
+            data.parser.text_continues = 0;
+        }
         if (data.error) {
             return;
         }
@@ -400,6 +416,7 @@ int xml_parser_parse(const char *buffer, unsigned int buffer_size, int is_final)
     }
     memcpy(data.buffer.data + data.buffer.cursor, buffer, buffer_size);
     data.parser.current_position = 0;
+    data.parser.buffer_end = is_final ? 0 : buffer_size + data.buffer.cursor;
     do {
         data.parser.context.ntokens = 0;
         result = sxml_parse(&data.parser.context, data.buffer.data, buffer_size + data.buffer.cursor,
@@ -443,6 +460,20 @@ int xml_parser_parse(const char *buffer, unsigned int buffer_size, int is_final)
     return 1;
 }
 
+int xml_parser_parse_file(FILE *file)
+{
+    char chunk[XML_FILE_CHUNK_SIZE];
+    int done;
+    do {
+        size_t bytes_read = fread(chunk, 1, XML_FILE_CHUNK_SIZE, file);
+        done = bytes_read < XML_FILE_CHUNK_SIZE;
+        if (!xml_parser_parse(chunk, (unsigned int) bytes_read, done)) {
+            return 0;
+        }
+    } while (!done);
+    return 1;
+}
+
 static const char *get_attribute_value(const char *key)
 {
     if (!key || !data.attributes.first) {
@@ -547,6 +578,7 @@ const char *xml_parser_get_parent_element_name(void)
 
 void xml_parser_reset(void)
 {
+    data.parser.text_continues = 0;
     data.error = 0;
     sxml_init(&data.parser.context);
     data.depth = 0;
@@ -565,6 +597,7 @@ void xml_parser_reset(void)
 
 void xml_parser_free(void)
 {
+    data.parser.text_continues = 0;
     data.error = 0;
 
     free(data.elements);
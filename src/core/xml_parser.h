@@ -1,6 +1,8 @@
 #ifndef CORE_XML_PARSER_H
 #define CORE_XML_PARSER_H
 
+#include <stdio.h>
+
 #define XML_PARSER_MAX_ATTRIBUTES 13
 #define XML_PARSER_TAG_MAX_LENGTH 12
 
@@ -39,6 +41,16 @@ int xml_parser_init(const xml_parser_element *elements, int total_elements, int
  */
 int xml_parser_parse(const char *buffer, unsigned int buffer_size, int is_final);
 
+/**
+ * @brief Parses a whole xml file, reading it in small chunks.
+ *
+ * Only the unparsed remainder of the current chunk is kept in memory, so the file does not need to be loaded first.
+ *
+ * @param file The file to read from, opened for reading.
+ * @return 1 if parsing was successful, 0 otherwise.
+ */
+int xml_parser_parse_file(FILE *file);
+
 /**
  * @brief Whether an element has a specific attribute.
  * 
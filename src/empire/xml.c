@@ -774,7 +774,7 @@ static void set_trade_coords(const empire_object *our_city)
     free(section_distances);
 }
 
-static int parse_xml(char *buf, int buffer_length)
+static int parse_xml(FILE *file)
 {
     reset_data();
     empire_clear();
@@ -782,7 +782,7 @@ static int parse_xml(char *buf, int buffer_length)
     if (!xml_parser_init(xml_elements, XML_TOTAL_ELEMENTS, 0)) {
         return 0;
     }
-    if (!xml_parser_parse(buf, buffer_length, 1)) {
+    if (!xml_parser_parse_file(file)) {
         data.success = 0;
     }
     xml_parser_free();
@@ -802,45 +802,15 @@ static int parse_xml(char *buf, int buffer_length)
     return data.success;
 }
 
-static char *file_to_buffer(const char *filename, int *output_length)
+int empire_xml_parse_file(const char *filename)
 {
     FILE *file = file_open(filename, "r");
     if (!file) {
         log_error("Error opening empire file", filename, 0);
         return 0;
     }
-    fseek(file, 0, SEEK_END);
-    int size = ftell(file);
-    rewind(file);
-
-    char *buf = malloc(size);
-    if (!buf) {
-        log_error("Unable to allocate buffer to read XML file", filename, 0);
-        file_close(file);
-        return 0;
-    }
-    memset(buf, 0, size);
-    *output_length = (int) fread(buf, 1, size, file);
-    if (*output_length > size) {
-        log_error("Unable to read file into buffer", filename, 0);
-        free(buf);
-        file_close(file);
-        *output_length = 0;
-        return 0;
-    }
+    int success = parse_xml(file);
     file_close(file);
-    return buf;
-}
-
-int empire_xml_parse_file(const char *filename)
-{
-    int output_length = 0;
-    char *xml_contents = file_to_buffer(filename, &output_length);
-    if (!xml_contents) {
-        return 0;
-    }
-    int success = parse_xml(xml_contents, output_length);
-    free(xml_contents);
     if (!success) {
         log_error("Error parsing file", filename, 0);
     }
@@ -175,126 +175,164 @@ void figure_combat_handle_attack(figure *f)
     }
 }
 
-int figure_combat_get_target_for_soldier(int x, int y, int max_distance)
+static struct {
+    int x;
+    int y;
+    int max_distance;
+    int min_distance;
+    int min_figure_id;
+    int first_figure_id;
+    int attack_citizens;
+    formation *formation;
+} search;
+
+static void start_search(int x, int y, int max_distance, int min_distance)
 {
-    int min_figure_id = 0;
-    int min_distance = 10000;
-    for (int i = 1; i < figure_count(); i++) {
-        figure *f = figure_get(i);
-        if (figure_is_dead(f) || f->is_ghost) {
-            // Do not allow to target dead and enemies located outside of the map
-            continue;
-        }
-        if (figure_is_enemy(f) || f->type == FIGURE_RIOTER || is_attacking_native(f)) {
-            int distance = calc_maximum_distance(x, y, f->x, f->y);
-            if (distance <= max_distance) {
-                if (f->targeted_by_figure_id) {
-                    distance *= 2; // penalty
-                }
-                if (distance < min_distance) {
-                    min_distance = distance;
-                    min_figure_id = i;
-                }
-            }
-        }
+    search.x = x;
+    search.y = y;
+    search.max_distance = max_distance;
+    search.min_distance = min_distance;
+    search.min_figure_id = 0;
+    search.first_figure_id = 0;
+}
+
+// Figures are visited in no particular order, so ties are broken on the lowest figure id,
+// just like a scan through all figures in id order would do
+static int is_closer_than_current_target(const figure *f, int distance)
+{
+    return distance < search.min_distance ||
+        (distance == search.min_distance && search.min_figure_id && (int) f->id < search.min_figure_id);
+}
+
+static void set_closest_target(const figure *f, int distance)
+{
+    search.min_distance = distance;
+    search.min_figure_id = f->id;
+}
+
+static void set_first_target(const figure *f)
+{
+    if (!search.first_figure_id || (int) f->id < search.first_figure_id) {
+        search.first_figure_id = f->id;
+    }
+}
+
+static int is_soldier_target(const figure *f)
+{
+    return figure_is_enemy(f) || f->type == FIGURE_RIOTER || is_attacking_native(f);
+}
+
+static void find_closest_target_for_soldier(figure *f)
+{
+    if (figure_is_dead(f) || f->is_ghost || !is_soldier_target(f)) {
+        // Do not allow to target dead and enemies located outside of the map
+        return;
     }
-    if (min_figure_id) {
-        return min_figure_id;
+    int distance = calc_maximum_distance(search.x, search.y, f->x, f->y);
+    if (distance > search.max_distance) {
+        return;
     }
+    if (f->targeted_by_figure_id) {
+        distance *= 2; // penalty
+    }
+    if (is_closer_than_current_target(f, distance)) {
+        set_closest_target(f, distance);
+    }
+}
+
+int figure_combat_get_target_for_soldier(int x, int y, int max_distance)
+{
+    start_search(x, y, max_distance, 10000);
+    map_figure_foreach_in_distance(x, y, max_distance,
+        MAP_FIGURE_CATEGORY_FLAG(MAP_FIGURE_CATEGORY_HOSTILE), find_closest_target_for_soldier);
+    if (search.min_figure_id) {
+        return search.min_figure_id;
+    }
+    // Enemies that wait outside the map are not in the figure areas, but can still be marched to
     for (int i = 1; i < figure_count(); i++) {
         figure *f = figure_get(i);
-        if (figure_is_dead(f)) {
-            continue;
-        }
-        if (figure_is_enemy(f) || f->type == FIGURE_RIOTER || is_attacking_native(f)) {
+        if (!figure_is_dead(f) && is_soldier_target(f)) {
             return i;
         }
     }
     return 0;
 }
 
-int figure_combat_get_target_for_wolf(int x, int y, int max_distance)
+static void find_closest_target_for_wolf(figure *f)
 {
-    int min_figure_id = 0;
-    int min_distance = 10000;
-    for (int i = 1; i < figure_count(); i++) {
-        figure *f = figure_get(i);
-        if (figure_is_dead(f) || !f->type) {
-            continue;
-        }
-        switch (f->type) {
-            case FIGURE_EXPLOSION:
-            case FIGURE_FORT_STANDARD:
-            case FIGURE_TRADE_SHIP:
-            case FIGURE_FISHING_BOAT:
-            case FIGURE_MAP_FLAG:
-            case FIGURE_FLOTSAM:
-            case FIGURE_SHIPWRECK:
-            case FIGURE_INDIGENOUS_NATIVE:
-            case FIGURE_TOWER_SENTRY:
-            case FIGURE_NATIVE_TRADER:
-            case FIGURE_ARROW:
-            case FIGURE_JAVELIN:
-            case FIGURE_BOLT:
-            case FIGURE_BALLISTA:
-            case FIGURE_CATAPULT_MISSILE:
-            case FIGURE_FRIENDLY_ARROW:
-            case FIGURE_WATCHTOWER_ARCHER:
-            case FIGURE_CREATURE:
-                continue;
-        }
-        if (figure_is_herd(f)) {
-            continue;
-        }
-        if (figure_is_legion(f) && f->action_state == FIGURE_ACTION_80_SOLDIER_AT_REST) {
-            continue;
-        }
-        int distance = calc_maximum_distance(x, y, f->x, f->y);
-        if (f->targeted_by_figure_id) {
-            distance *= 2;
-        }
-        if (distance < min_distance) {
-            min_distance = distance;
-            min_figure_id = i;
-        }
+    if (figure_is_dead(f) || !f->type) {
+        return;
+    }
+    switch (f->type) {
+        case FIGURE_EXPLOSION:
+        case FIGURE_FORT_STANDARD:
+        case FIGURE_TRADE_SHIP:
+        case FIGURE_FISHING_BOAT:
+        case FIGURE_MAP_FLAG:
+        case FIGURE_FLOTSAM:
+        case FIGURE_SHIPWRECK:
+        case FIGURE_INDIGENOUS_NATIVE:
+        case FIGURE_TOWER_SENTRY:
+        case FIGURE_NATIVE_TRADER:
+        case FIGURE_ARROW:
+        case FIGURE_JAVELIN:
+        case FIGURE_BOLT:
+        case FIGURE_BALLISTA:
+        case FIGURE_CATAPULT_MISSILE:
+        case FIGURE_FRIENDLY_ARROW:
+        case FIGURE_WATCHTOWER_ARCHER:
+        case FIGURE_CREATURE:
+            return;
     }
-    if (min_distance <= max_distance && min_figure_id) {
-        return min_figure_id;
+    if (figure_is_herd(f)) {
+        return;
+    }
+    if (figure_is_legion(f) && f->action_state == FIGURE_ACTION_80_SOLDIER_AT_REST) {
+        return;
+    }
+    int distance = calc_maximum_distance(search.x, search.y, f->x, f->y);
+    if (f->targeted_by_figure_id) {
+        distance *= 2;
+    }
+    if (is_closer_than_current_target(f, distance)) {
+        set_closest_target(f, distance);
+    }
+}
+
+int figure_combat_get_target_for_wolf(int x, int y, int max_distance)
+{
+    // The penalty only increases the distance, so figures further away than max_distance never qualify
+    start_search(x, y, max_distance, 10000);
+    map_figure_foreach_in_distance(x, y, max_distance, MAP_FIGURE_CATEGORY_ALL, find_closest_target_for_wolf);
+    if (search.min_distance <= max_distance && search.min_figure_id) {
+        return search.min_figure_id;
     }
     return 0;
 }
 
-int figure_combat_get_target_for_enemy(int x, int y)
+static void find_target_for_enemy(figure *f)
 {
-    int min_figure_id = 0;
-    int min_distance = 10000;
-    for (int i = 1; i < figure_count(); i++) {
-        figure *f = figure_get(i);
-        if (figure_is_dead(f)) {
-            continue;
-        }
-        if (!f->targeted_by_figure_id && figure_is_legion(f)) {
-            int distance = calc_maximum_distance(x, y, f->x, f->y);
-            if (distance < min_distance) {
-                min_distance = distance;
-                min_figure_id = i;
-            }
+    if (figure_is_dead(f) || !figure_is_legion(f)) {
+        return;
+    }
+    set_first_target(f);
+    if (!f->targeted_by_figure_id) {
+        int distance = calc_maximum_distance(search.x, search.y, f->x, f->y);
+        if (is_closer_than_current_target(f, distance)) {
+            set_closest_target(f, distance);
         }
     }
-    if (min_figure_id) {
-        return min_figure_id;
+}
+
+int figure_combat_get_target_for_enemy(int x, int y)
+{
+    start_search(x, y, 0, 10000);
+    map_figure_foreach_of_category(MAP_FIGURE_CATEGORY_FLAG(MAP_FIGURE_CATEGORY_SOLDIER), find_target_for_enemy);
+    if (search.min_figure_id) {
+        return search.min_figure_id;
     }
     // no 'free' soldier found, take first one
-    for (int i = 1; i < figure_count(); i++) {
-        figure *f = figure_get(i);
-        if (figure_is_dead(f)) {
-            continue;
-        }
-        if (figure_is_legion(f)) {
-            return i;
-        }
-    }
-    return 0;
+    return search.first_figure_id;
 }
 
 static int is_valid_missile_target(figure *f, formation *l)
@@ -314,35 +352,77 @@ static int is_valid_missile_target(figure *f, formation *l)
     return 0;
 }
 
-int figure_combat_get_missile_target_for_soldier(figure *shooter, int max_distance, map_point *tile)
+static void find_missile_target_for_soldier(figure *f)
 {
-    int x = shooter->x;
-    int y = shooter->y;
-
-    int min_distance = max_distance;
-    figure *min_figure = 0;
-    formation *l = formation_get(shooter->formation_id);
-    for (int i = 1; i < figure_count(); i++) {
-        figure *f = figure_get(i);
-        if (figure_is_dead(f) || f->is_ghost) {
-            // Do not allow to target dead and enemies located outside of the map
-            continue;
-        }
-        if (is_valid_missile_target(f, l)) {
-            int distance = calc_maximum_distance(x, y, f->x, f->y);
-            if (distance < min_distance && figure_movement_can_launch_cross_country_missile(x, y, f->x, f->y)) {
-                min_distance = distance;
-                min_figure = f;
-            }
+    if (figure_is_dead(f) || f->is_ghost) {
+        // Do not allow to target dead and enemies located outside of the map
+        return;
+    }
+    if (is_valid_missile_target(f, search.formation)) {
+        int distance = calc_maximum_distance(search.x, search.y, f->x, f->y);
+        if (is_closer_than_current_target(f, distance) &&
+            figure_movement_can_launch_cross_country_missile(search.x, search.y, f->x, f->y)) {
+            set_closest_target(f, distance);
         }
     }
-    if (min_figure) {
+}
+
+int figure_combat_get_missile_target_for_soldier(figure *shooter, int max_distance, map_point *tile)
+{
+    start_search(shooter->x, shooter->y, max_distance, max_distance);
+    search.formation = formation_get(shooter->formation_id);
+    map_figure_foreach_in_distance(search.x, search.y, max_distance - 1,
+        MAP_FIGURE_CATEGORY_FLAG(MAP_FIGURE_CATEGORY_HOSTILE), find_missile_target_for_soldier);
+    if (search.min_figure_id) {
+        figure *min_figure = figure_get(search.min_figure_id);
         map_point_store_result(min_figure->x, min_figure->y, tile);
         return min_figure->id;
     }
     return 0;
 }
 
+static void find_missile_target_for_enemy(figure *f)
+{
+    if (figure_is_dead(f) || !f->type) {
+        return;
+    }
+    switch (f->type) {
+        case FIGURE_EXPLOSION:
+        case FIGURE_FORT_STANDARD:
+        case FIGURE_MAP_FLAG:
+        case FIGURE_FLOTSAM:
+        case FIGURE_INDIGENOUS_NATIVE:
+        case FIGURE_NATIVE_TRADER:
+        case FIGURE_ARROW:
+        case FIGURE_JAVELIN:
+        case FIGURE_BOLT:
+        case FIGURE_BALLISTA:
+        case FIGURE_FRIENDLY_ARROW:
+        case FIGURE_CATAPULT_MISSILE:
+        case FIGURE_WATCHTOWER_ARCHER:
+        case FIGURE_CREATURE:
+        case FIGURE_FISH_GULLS:
+        case FIGURE_SHIPWRECK:
+        case FIGURE_SHEEP:
+        case FIGURE_WOLF:
+        case FIGURE_ZEBRA:
+        case FIGURE_SPEAR:
+            return;
+    }
+    int distance;
+    if (figure_is_legion(f)) {
+        distance = calc_maximum_distance(search.x, search.y, f->x, f->y);
+    } else if (search.attack_citizens && f->is_friendly) {
+        distance = calc_maximum_distance(search.x, search.y, f->x, f->y) + 5;
+    } else {
+        return;
+    }
+    if (is_closer_than_current_target(f, distance) &&
+        figure_movement_can_launch_cross_country_missile(search.x, search.y, f->x, f->y)) {
+        set_closest_target(f, distance);
+    }
+}
+
 int figure_combat_get_missile_target_for_enemy(figure *enemy, int max_distance, int attack_citizens,
                                                map_point *tile)
 {
@@ -350,53 +430,13 @@ int figure_combat_get_missile_target_for_enemy(figure *enemy, int max_distance,
         // Do not allow enemies to attack from outside of the map
         return 0;
     }
-    int x = enemy->x;
-    int y = enemy->y;
-
-    figure *min_figure = 0;
-    int min_distance = max_distance;
-    for (int i = 1; i < figure_count(); i++) {
-        figure *f = figure_get(i);
-        if (figure_is_dead(f) || !f->type) {
-            continue;
-        }
-        switch (f->type) {
-            case FIGURE_EXPLOSION:
-            case FIGURE_FORT_STANDARD:
-            case FIGURE_MAP_FLAG:
-            case FIGURE_FLOTSAM:
-            case FIGURE_INDIGENOUS_NATIVE:
-            case FIGURE_NATIVE_TRADER:
-            case FIGURE_ARROW:
-            case FIGURE_JAVELIN:
-            case FIGURE_BOLT:
-            case FIGURE_BALLISTA:
-            case FIGURE_FRIENDLY_ARROW:
-            case FIGURE_CATAPULT_MISSILE:
-            case FIGURE_WATCHTOWER_ARCHER:
-            case FIGURE_CREATURE:
-            case FIGURE_FISH_GULLS:
-            case FIGURE_SHIPWRECK:
-            case FIGURE_SHEEP:
-            case FIGURE_WOLF:
-            case FIGURE_ZEBRA:
-            case FIGURE_SPEAR:
-                continue;
-        }
-        int distance;
-        if (figure_is_legion(f)) {
-            distance = calc_maximum_distance(x, y, f->x, f->y);
-        } else if (attack_citizens && f->is_friendly) {
-            distance = calc_maximum_distance(x, y, f->x, f->y) + 5;
-        } else {
-            continue;
-        }
-        if (distance < min_distance && figure_movement_can_launch_cross_country_missile(x, y, f->x, f->y)) {
-            min_distance = distance;
-            min_figure = f;
-        }
-    }
-    if (min_figure) {
+    start_search(enemy->x, enemy->y, max_distance, max_distance);
+    search.attack_citizens = attack_citizens;
+    int categories = attack_citizens ?
+        MAP_FIGURE_CATEGORY_ALL : MAP_FIGURE_CATEGORY_FLAG(MAP_FIGURE_CATEGORY_SOLDIER);
+    map_figure_foreach_in_distance(search.x, search.y, max_distance - 1, categories, find_missile_target_for_enemy);
+    if (search.min_figure_id) {
+        figure *min_figure = figure_get(search.min_figure_id);
         map_point_store_result(min_figure->x, min_figure->y, tile);
         return min_figure->id;
     }
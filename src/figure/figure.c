@@ -279,104 +279,107 @@ int figure_target_is_alive(const figure *f)
 
 static void figure_save(buffer *buf, const figure *f)
 {
-    buffer_write_u8(buf, f->alternative_location_index);
-    buffer_write_u8(buf, f->image_offset);
-    buffer_write_u8(buf, f->is_enemy_image);
-    buffer_write_u8(buf, f->flotsam_visible);
-    buffer_write_i16(buf, f->image_id);
-    buffer_write_i16(buf, f->cart_image_id);
-    buffer_write_i16(buf, f->next_figure_id_on_same_tile);
-    buffer_write_u8(buf, f->type);
-    buffer_write_u8(buf, f->resource_id);
-    buffer_write_u8(buf, f->use_cross_country);
-    buffer_write_u8(buf, f->is_friendly);
-    buffer_write_u8(buf, f->state);
-    buffer_write_u8(buf, f->faction_id);
-    buffer_write_u8(buf, f->action_state_before_attack);
-    buffer_write_i8(buf, f->direction);
-    buffer_write_i8(buf, f->previous_tile_direction);
-    buffer_write_i8(buf, f->attack_direction);
-    buffer_write_u8(buf, f->x);
-    buffer_write_u8(buf, f->y);
-    buffer_write_u8(buf, f->previous_tile_x);
-    buffer_write_u8(buf, f->previous_tile_y);
-    buffer_write_u8(buf, f->missile_height);
-    buffer_write_u8(buf, f->damage);
-    buffer_write_i16(buf, f->grid_offset);
-    buffer_write_u8(buf, f->destination_x);
-    buffer_write_u8(buf, f->destination_y);
-    buffer_write_i16(buf, f->destination_grid_offset);
-    buffer_write_u8(buf, f->source_x);
-    buffer_write_u8(buf, f->source_y);
-    buffer_write_u8(buf, f->formation_position_x.soldier);
-    buffer_write_u8(buf, f->formation_position_y.soldier);
-    buffer_write_i16(buf, f->disallow_diagonal);
-    buffer_write_i16(buf, f->wait_ticks);
-    buffer_write_u8(buf, f->action_state);
-    buffer_write_u8(buf, f->progress_on_tile);
-    buffer_write_i16(buf, f->routing_path_id);
-    buffer_write_i16(buf, f->routing_path_current_tile);
-    buffer_write_i16(buf, f->routing_path_length);
-    buffer_write_u8(buf, f->in_building_wait_ticks);
-    buffer_write_u8(buf, f->is_on_road);
-    buffer_write_i16(buf, f->max_roam_length);
-    buffer_write_i16(buf, f->roam_length);
-    buffer_write_u8(buf, f->roam_choose_destination);
-    buffer_write_u8(buf, f->roam_random_counter);
-    buffer_write_i8(buf, f->roam_turn_direction);
-    buffer_write_i8(buf, f->roam_ticks_until_next_turn);
-    buffer_write_i16(buf, f->cross_country_x);
-    buffer_write_i16(buf, f->cross_country_y);
-    buffer_write_i16(buf, f->cc_destination_x);
-    buffer_write_i16(buf, f->cc_destination_y);
-    buffer_write_i16(buf, f->cc_delta_x);
-    buffer_write_i16(buf, f->cc_delta_y);
-    buffer_write_i16(buf, f->cc_delta_xy);
-    buffer_write_u8(buf, f->cc_direction);
-    buffer_write_u8(buf, f->speed_multiplier);
-    buffer_write_i16(buf, f->building_id);
-    buffer_write_i16(buf, f->immigrant_building_id);
-    buffer_write_i16(buf, f->destination_building_id);
-    buffer_write_i16(buf, f->formation_id);
-    buffer_write_u8(buf, f->index_in_formation);
-    buffer_write_u8(buf, f->formation_at_rest);
-    buffer_write_u8(buf, f->migrant_num_people);
-    buffer_write_u8(buf, f->is_ghost);
-    buffer_write_u8(buf, f->min_max_seen);
-    buffer_write_i8(buf, f->progress_to_next_tick);
-    buffer_write_i16(buf, f->leading_figure_id);
-    buffer_write_u8(buf, f->attack_image_offset);
-    buffer_write_u8(buf, f->wait_ticks_missile);
-    buffer_write_i8(buf, f->x_offset_cart);
-    buffer_write_i8(buf, f->y_offset_cart);
-    buffer_write_u8(buf, f->empire_city_id);
-    buffer_write_u8(buf, f->trader_amount_bought);
-    buffer_write_i16(buf, f->name);
-    buffer_write_u8(buf, f->terrain_usage);
-    buffer_write_u8(buf, f->loads_sold_or_carrying);
-    buffer_write_u8(buf, f->is_boat);
-    buffer_write_u8(buf, f->height_adjusted_ticks);
-    buffer_write_u8(buf, f->current_height);
-    buffer_write_u8(buf, f->target_height);
-    buffer_write_u8(buf, f->collecting_item_id);
-    buffer_write_u8(buf, f->trade_ship_failed_dock_attempts);
-    buffer_write_u8(buf, f->phrase_sequence_exact);
-    buffer_write_i8(buf, f->phrase_id);
-    buffer_write_u8(buf, f->phrase_sequence_city);
-    buffer_write_u8(buf, f->trader_id);
-    buffer_write_u8(buf, f->wait_ticks_next_target);
-    buffer_write_u8(buf, f->dont_draw_elevated);
-    buffer_write_i16(buf, f->target_figure_id);
-    buffer_write_i16(buf, f->targeted_by_figure_id);
-    buffer_write_u16(buf, f->created_sequence);
-    buffer_write_u16(buf, f->target_figure_created_sequence);
-    buffer_write_u8(buf, f->figures_on_same_tile_index);
-    buffer_write_u8(buf, f->num_attackers);
-    buffer_write_i16(buf, f->attacker_id1);
-    buffer_write_i16(buf, f->attacker_id2);
-    buffer_write_i16(buf, f->opponent_id);
-    buffer_write_i16(buf, f->last_visited_index);
-    buffer_write_i16(buf, f->last_destinatation_id);
+    if (!buffer_reserve(buf, FIGURE_CURRENT_BUFFER_SIZE)) {
+        return;
+    }
+    buffer_write_u8_unchecked(buf, f->alternative_location_index);
+    buffer_write_u8_unchecked(buf, f->image_offset);
+    buffer_write_u8_unchecked(buf, f->is_enemy_image);
+    buffer_write_u8_unchecked(buf, f->flotsam_visible);
+    buffer_write_i16_unchecked(buf, f->image_id);
+    buffer_write_i16_unchecked(buf, f->cart_image_id);
+    buffer_write_i16_unchecked(buf, f->next_figure_id_on_same_tile);
+    buffer_write_u8_unchecked(buf, f->type);
+    buffer_write_u8_unchecked(buf, f->resource_id);
+    buffer_write_u8_unchecked(buf, f->use_cross_country);
+    buffer_write_u8_unchecked(buf, f->is_friendly);
+    buffer_write_u8_unchecked(buf, f->state);
+    buffer_write_u8_unchecked(buf, f->faction_id);
+    buffer_write_u8_unchecked(buf, f->action_state_before_attack);
+    buffer_write_i8_unchecked(buf, f->direction);
+    buffer_write_i8_unchecked(buf, f->previous_tile_direction);
+    buffer_write_i8_unchecked(buf, f->attack_direction);
+    buffer_write_u8_unchecked(buf, f->x);
+    buffer_write_u8_unchecked(buf, f->y);
+    buffer_write_u8_unchecked(buf, f->previous_tile_x);
+    buffer_write_u8_unchecked(buf, f->previous_tile_y);
+    buffer_write_u8_unchecked(buf, f->missile_height);
+    buffer_write_u8_unchecked(buf, f->damage);
+    buffer_write_i16_unchecked(buf, f->grid_offset);
+    buffer_write_u8_unchecked(buf, f->destination_x);
+    buffer_write_u8_unchecked(buf, f->destination_y);
+    buffer_write_i16_unchecked(buf, f->destination_grid_offset);
+    buffer_write_u8_unchecked(buf, f->source_x);
+    buffer_write_u8_unchecked(buf, f->source_y);
+    buffer_write_u8_unchecked(buf, f->formation_position_x.soldier);
+    buffer_write_u8_unchecked(buf, f->formation_position_y.soldier);
+    buffer_write_i16_unchecked(buf, f->disallow_diagonal);
+    buffer_write_i16_unchecked(buf, f->wait_ticks);
+    buffer_write_u8_unchecked(buf, f->action_state);
+    buffer_write_u8_unchecked(buf, f->progress_on_tile);
+    buffer_write_i16_unchecked(buf, f->routing_path_id);
+    buffer_write_i16_unchecked(buf, f->routing_path_current_tile);
+    buffer_write_i16_unchecked(buf, f->routing_path_length);
+    buffer_write_u8_unchecked(buf, f->in_building_wait_ticks);
+    buffer_write_u8_unchecked(buf, f->is_on_road);
+    buffer_write_i16_unchecked(buf, f->max_roam_length);
+    buffer_write_i16_unchecked(buf, f->roam_length);
+    buffer_write_u8_unchecked(buf, f->roam_choose_destination);
+    buffer_write_u8_unchecked(buf, f->roam_random_counter);
+    buffer_write_i8_unchecked(buf, f->roam_turn_direction);
+    buffer_write_i8_unchecked(buf, f->roam_ticks_until_next_turn);
+    buffer_write_i16_unchecked(buf, f->cross_country_x);
+    buffer_write_i16_unchecked(buf, f->cross_country_y);
+    buffer_write_i16_unchecked(buf, f->cc_destination_x);
+    buffer_write_i16_unchecked(buf, f->cc_destination_y);
+    buffer_write_i16_unchecked(buf, f->cc_delta_x);
+    buffer_write_i16_unchecked(buf, f->cc_delta_y);
+    buffer_write_i16_unchecked(buf, f->cc_delta_xy);
+    buffer_write_u8_unchecked(buf, f->cc_direction);
+    buffer_write_u8_unchecked(buf, f->speed_multiplier);
+    buffer_write_i16_unchecked(buf, f->building_id);
+    buffer_write_i16_unchecked(buf, f->immigrant_building_id);
+    buffer_write_i16_unchecked(buf, f->destination_building_id);
+    buffer_write_i16_unchecked(buf, f->formation_id);
+    buffer_write_u8_unchecked(buf, f->index_in_formation);
+    buffer_write_u8_unchecked(buf, f->formation_at_rest);
+    buffer_write_u8_unchecked(buf, f->migrant_num_people);
+    buffer_write_u8_unchecked(buf, f->is_ghost);
+    buffer_write_u8_unchecked(buf, f->min_max_seen);
+    buffer_write_i8_unchecked(buf, f->progress_to_next_tick);
+    buffer_write_i16_unchecked(buf, f->leading_figure_id);
+    buffer_write_u8_unchecked(buf, f->attack_image_offset);
+    buffer_write_u8_unchecked(buf, f->wait_ticks_missile);
+    buffer_write_i8_unchecked(buf, f->x_offset_cart);
+    buffer_write_i8_unchecked(buf, f->y_offset_cart);
+    buffer_write_u8_unchecked(buf, f->empire_city_id);
+    buffer_write_u8_unchecked(buf, f->trader_amount_bought);
+    buffer_write_i16_unchecked(buf, f->name);
+    buffer_write_u8_unchecked(buf, f->terrain_usage);
+    buffer_write_u8_unchecked(buf, f->loads_sold_or_carrying);
+    buffer_write_u8_unchecked(buf, f->is_boat);
+    buffer_write_u8_unchecked(buf, f->height_adjusted_ticks);
+    buffer_write_u8_unchecked(buf, f->current_height);
+    buffer_write_u8_unchecked(buf, f->target_height);
+    buffer_write_u8_unchecked(buf, f->collecting_item_id);
+    buffer_write_u8_unchecked(buf, f->trade_ship_failed_dock_attempts);
+    buffer_write_u8_unchecked(buf, f->phrase_sequence_exact);
+    buffer_write_i8_unchecked(buf, f->phrase_id);
+    buffer_write_u8_unchecked(buf, f->phrase_sequence_city);
+    buffer_write_u8_unchecked(buf, f->trader_id);
+    buffer_write_u8_unchecked(buf, f->wait_ticks_next_target);
+    buffer_write_u8_unchecked(buf, f->dont_draw_elevated);
+    buffer_write_i16_unchecked(buf, f->target_figure_id);
+    buffer_write_i16_unchecked(buf, f->targeted_by_figure_id);
+    buffer_write_u16_unchecked(buf, f->created_sequence);
+    buffer_write_u16_unchecked(buf, f->target_figure_created_sequence);
+    buffer_write_u8_unchecked(buf, f->figures_on_same_tile_index);
+    buffer_write_u8_unchecked(buf, f->num_attackers);
+    buffer_write_i16_unchecked(buf, f->attacker_id1);
+    buffer_write_i16_unchecked(buf, f->attacker_id2);
+    buffer_write_i16_unchecked(buf, f->opponent_id);
+    buffer_write_i16_unchecked(buf, f->last_visited_index);
+    buffer_write_i16_unchecked(buf, f->last_destinatation_id);
 }
 
 static int get_resource_id(figure_type type, int resource)
@@ -11,6 +11,54 @@
 typedef struct {
     unsigned int id;
 
+    // movement state, kept together so that moving a figure touches as little memory as possible
+    unsigned char state;
+    unsigned char type;
+    unsigned char faction_id; // 2 = roamer preview, 1 = city, 0 = enemy
+    unsigned char action_state;
+    unsigned char x;
+    unsigned char y;
+    short grid_offset;
+    signed char direction;
+    signed char previous_tile_direction;
+    unsigned char previous_tile_x;
+    unsigned char previous_tile_y;
+    unsigned char progress_on_tile;
+    char progress_to_next_tick;
+    unsigned char speed_multiplier;
+    unsigned char use_cross_country;
+    short routing_path_id;
+    short routing_path_current_tile;
+    short routing_path_length;
+    unsigned char destination_x;
+    unsigned char destination_y;
+    unsigned char source_x;
+    unsigned char source_y;
+    short cross_country_x; // position = 15 * x + offset on tile
+    short cross_country_y; // position = 15 * y + offset on tile
+    short cc_destination_x;
+    short cc_destination_y;
+    short cc_delta_x;
+    short cc_delta_y;
+    short cc_delta_xy;
+    unsigned char cc_direction; // 1 = x, 2 = y
+    unsigned char is_ghost;
+    unsigned char height_adjusted_ticks;
+    unsigned char current_height;
+    unsigned char target_height;
+    unsigned char missile_height;
+    unsigned char terrain_usage;
+    unsigned char is_boat; // 1 for boat, 2 for flotsam
+    unsigned char roam_choose_destination;
+    unsigned char roam_random_counter;
+    signed char roam_turn_direction;
+    signed char roam_ticks_until_next_turn;
+    short roam_length;
+    short max_roam_length;
+    short disallow_diagonal;
+    unsigned char is_on_road;
+    unsigned char in_building_wait_ticks;
+
     unsigned int image_id;
     unsigned int cart_image_id;
     unsigned char image_offset;
@@ -19,28 +67,14 @@ typedef struct {
     unsigned char alternative_location_index;
     unsigned char flotsam_visible;
     short next_figure_id_on_same_tile;
-    unsigned char type;
+    short next_figure_id_in_area;
+    short previous_figure_id_in_area;
+    unsigned short area_list; // runtime only, 0 = not in the area index of map/figure
     unsigned char resource_id;
-    unsigned char use_cross_country;
     unsigned char is_friendly;
-    unsigned char state;
-    unsigned char faction_id; // 2 = roamer preview, 1 = city, 0 = enemy
     unsigned char action_state_before_attack;
-    signed char direction;
-    signed char previous_tile_direction;
     signed char attack_direction;
-    unsigned char x;
-    unsigned char y;
-    unsigned char previous_tile_x;
-    unsigned char previous_tile_y;
-    unsigned char missile_height;
-    unsigned char damage;
-    short grid_offset;
-    unsigned char destination_x;
-    unsigned char destination_y;
     short destination_grid_offset; // only used for soldiers
-    unsigned char source_x;
-    unsigned char source_y;
     union {
         unsigned char soldier;
         signed char enemy;
@@ -49,30 +83,7 @@ typedef struct {
         unsigned char soldier;
         signed char enemy;
     } formation_position_y;
-    short disallow_diagonal;
     short wait_ticks;
-    unsigned char action_state;
-    unsigned char progress_on_tile;
-    short routing_path_id;
-    short routing_path_current_tile;
-    short routing_path_length;
-    unsigned char in_building_wait_ticks;
-    unsigned char is_on_road;
-    short max_roam_length;
-    short roam_length;
-    unsigned char roam_choose_destination;
-    unsigned char roam_random_counter;
-    signed char roam_turn_direction;
-    signed char roam_ticks_until_next_turn;
-    short cross_country_x; // position = 15 * x + offset on tile
-    short cross_country_y; // position = 15 * y + offset on tile
-    short cc_destination_x;
-    short cc_destination_y;
-    short cc_delta_x;
-    short cc_delta_y;
-    short cc_delta_xy;
-    unsigned char cc_direction; // 1 = x, 2 = y
-    unsigned char speed_multiplier;
     short building_id;
     short immigrant_building_id;
     short destination_building_id;
@@ -80,9 +91,7 @@ typedef struct {
     unsigned char index_in_formation;
     unsigned char formation_at_rest;
     unsigned char migrant_num_people;
-    unsigned char is_ghost;
     unsigned char min_max_seen;
-    char progress_to_next_tick;
     short leading_figure_id;
     unsigned char attack_image_offset;
     unsigned char wait_ticks_missile;
@@ -91,12 +100,7 @@ typedef struct {
     unsigned char empire_city_id;
     unsigned char trader_amount_bought;
     short name;
-    unsigned char terrain_usage;
     unsigned char loads_sold_or_carrying;
-    unsigned char is_boat; // 1 for boat, 2 for flotsam
-    unsigned char height_adjusted_ticks;
-    unsigned char current_height;
-    unsigned char target_height;
     unsigned char collecting_item_id; // NOT a resource ID for cartpushers! IS a resource ID for warehousemen or lighthouse supplier
     unsigned char trade_ship_failed_dock_attempts;
     unsigned char phrase_sequence_exact;
@@ -105,6 +109,7 @@ typedef struct {
     unsigned char trader_id;
     unsigned char wait_ticks_next_target; //used for retargetting for fighting figures, and destination for pushers
     unsigned char dont_draw_elevated;
+    unsigned char damage;
     short target_figure_id;
     short targeted_by_figure_id;
     unsigned short created_sequence;
@@ -14,6 +14,7 @@
 #include "figure/formation_herd.h"
 #include "figure/formation_legion.h"
 #include "figure/properties.h"
+#include "game/replay.h"
 #include "game/save_version.h"
 #include "game/cheats.h"
 #include "map/grid.h"
@@ -179,6 +180,7 @@ void formation_set_selected(int formation_id)
 
 void formation_toggle_empire_service(int formation_id)
 {
+    game_replay_record_command(REPLAY_COMMAND_TOGGLE_EMPIRE_SERVICE, formation_id, 0, 0);
     array_item(formations, formation_id)->empire_service ^= 1;
 }
 
@@ -834,69 +836,72 @@ void formations_save_state(buffer *buf, buffer *totals)
 
     for (int i = 0; i < formations.size; i++) {
         formation *f = formation_get(i);
-        buffer_write_u8(buf, f->in_use);
-        buffer_write_u8(buf, f->faction_id);
-        buffer_write_u8(buf, f->legion_id);
-        buffer_write_u8(buf, f->is_at_fort);
-        buffer_write_i16(buf, f->figure_type);
-        buffer_write_i16(buf, f->building_id);
+        if (!buffer_reserve(buf, CURRENT_BUFFER_SIZE_PER_FORMATION)) {
+            break;
+        }
+        buffer_write_u8_unchecked(buf, f->in_use);
+        buffer_write_u8_unchecked(buf, f->faction_id);
+        buffer_write_u8_unchecked(buf, f->legion_id);
+        buffer_write_u8_unchecked(buf, f->is_at_fort);
+        buffer_write_i16_unchecked(buf, f->figure_type);
+        buffer_write_i16_unchecked(buf, f->building_id);
         for (int fig = 0; fig < MAX_FORMATION_FIGURES; fig++) {
-            buffer_write_i16(buf, f->figures[fig]);
+            buffer_write_i16_unchecked(buf, f->figures[fig]);
         }
-        buffer_write_u8(buf, f->num_figures);
-        buffer_write_u8(buf, f->max_figures);
-        buffer_write_i16(buf, f->layout);
-        buffer_write_i16(buf, f->morale);
-        buffer_write_u8(buf, f->x_home);
-        buffer_write_u8(buf, f->y_home);
-        buffer_write_u8(buf, f->standard_x);
-        buffer_write_u8(buf, f->standard_y);
-        buffer_write_u8(buf, f->x);
-        buffer_write_u8(buf, f->y);
-        buffer_write_u8(buf, f->destination_x);
-        buffer_write_u8(buf, f->destination_y);
-        buffer_write_i16(buf, f->destination_building_id);
-        buffer_write_i16(buf, f->standard_figure_id);
-        buffer_write_u8(buf, f->is_legion);
-        buffer_write_u8(buf, f->mess_hall_max_morale_modifier);
-        buffer_write_i32(buf, f->legion_flag_id);
-        buffer_write_i32(buf, f->legion_name_id);
-        buffer_write_i32(buf, f->legion_name_group);
-        buffer_write_i16(buf, f->attack_type);
-        buffer_write_i16(buf, f->legion_recruit_type);
-        buffer_write_i16(buf, f->has_military_training);
-        buffer_write_i16(buf, f->total_damage);
-        buffer_write_i16(buf, f->max_total_damage);
-        buffer_write_i16(buf, f->wait_ticks);
-        buffer_write_i16(buf, f->recent_fight);
-        buffer_write_i16(buf, f->enemy_state.duration_advance);
-        buffer_write_i16(buf, f->enemy_state.duration_regroup);
-        buffer_write_i16(buf, f->enemy_state.duration_halt);
-        buffer_write_i16(buf, f->enemy_legion_index);
-        buffer_write_i16(buf, f->is_halted);
-        buffer_write_i16(buf, f->missile_fired);
-        buffer_write_i16(buf, f->missile_attack_timeout);
-        buffer_write_i16(buf, f->missile_attack_formation_id);
-        buffer_write_i16(buf, f->prev.layout);
-        buffer_write_i16(buf, f->cursed_by_mars);
-        buffer_write_u8(buf, f->months_low_morale);
-        buffer_write_u8(buf, f->empire_service);
-        buffer_write_u8(buf, f->in_distant_battle);
-        buffer_write_u8(buf, f->is_herd);
-        buffer_write_u8(buf, f->enemy_type);
-        buffer_write_u8(buf, f->direction);
-        buffer_write_u8(buf, f->prev.x_home);
-        buffer_write_u8(buf, f->prev.y_home);
-        buffer_write_u8(buf, f->unknown_fired);
-        buffer_write_u8(buf, f->orientation);
-        buffer_write_u8(buf, f->months_from_home);
-        buffer_write_u8(buf, f->months_very_low_morale);
-        buffer_write_u8(buf, f->invasion_id);
-        buffer_write_u8(buf, f->herd_wolf_spawn_delay);
-        buffer_write_u8(buf, f->herd_direction);
-        buffer_write_i32(buf, f->target_formation_id);
+        buffer_write_u8_unchecked(buf, f->num_figures);
+        buffer_write_u8_unchecked(buf, f->max_figures);
+        buffer_write_i16_unchecked(buf, f->layout);
+        buffer_write_i16_unchecked(buf, f->morale);
+        buffer_write_u8_unchecked(buf, f->x_home);
+        buffer_write_u8_unchecked(buf, f->y_home);
+        buffer_write_u8_unchecked(buf, f->standard_x);
+        buffer_write_u8_unchecked(buf, f->standard_y);
+        buffer_write_u8_unchecked(buf, f->x);
+        buffer_write_u8_unchecked(buf, f->y);
+        buffer_write_u8_unchecked(buf, f->destination_x);
+        buffer_write_u8_unchecked(buf, f->destination_y);
+        buffer_write_i16_unchecked(buf, f->destination_building_id);
+        buffer_write_i16_unchecked(buf, f->standard_figure_id);
+        buffer_write_u8_unchecked(buf, f->is_legion);
+        buffer_write_u8_unchecked(buf, f->mess_hall_max_morale_modifier);
+        buffer_write_i32_unchecked(buf, f->legion_flag_id);
+        buffer_write_i32_unchecked(buf, f->legion_name_id);
+        buffer_write_i32_unchecked(buf, f->legion_name_group);
+        buffer_write_i16_unchecked(buf, f->attack_type);
+        buffer_write_i16_unchecked(buf, f->legion_recruit_type);
+        buffer_write_i16_unchecked(buf, f->has_military_training);
+        buffer_write_i16_unchecked(buf, f->total_damage);
+        buffer_write_i16_unchecked(buf, f->max_total_damage);
+        buffer_write_i16_unchecked(buf, f->wait_ticks);
+        buffer_write_i16_unchecked(buf, f->recent_fight);
+        buffer_write_i16_unchecked(buf, f->enemy_state.duration_advance);
+        buffer_write_i16_unchecked(buf, f->enemy_state.duration_regroup);
+        buffer_write_i16_unchecked(buf, f->enemy_state.duration_halt);
+        buffer_write_i16_unchecked(buf, f->enemy_legion_index);
+        buffer_write_i16_unchecked(buf, f->is_halted);
+        buffer_write_i16_unchecked(buf, f->missile_fired);
+        buffer_write_i16_unchecked(buf, f->missile_attack_timeout);
+        buffer_write_i16_unchecked(buf, f->missile_attack_formation_id);
+        buffer_write_i16_unchecked(buf, f->prev.layout);
+        buffer_write_i16_unchecked(buf, f->cursed_by_mars);
+        buffer_write_u8_unchecked(buf, f->months_low_morale);
+        buffer_write_u8_unchecked(buf, f->empire_service);
+        buffer_write_u8_unchecked(buf, f->in_distant_battle);
+        buffer_write_u8_unchecked(buf, f->is_herd);
+        buffer_write_u8_unchecked(buf, f->enemy_type);
+        buffer_write_u8_unchecked(buf, f->direction);
+        buffer_write_u8_unchecked(buf, f->prev.x_home);
+        buffer_write_u8_unchecked(buf, f->prev.y_home);
+        buffer_write_u8_unchecked(buf, f->unknown_fired);
+        buffer_write_u8_unchecked(buf, f->orientation);
+        buffer_write_u8_unchecked(buf, f->months_from_home);
+        buffer_write_u8_unchecked(buf, f->months_very_low_morale);
+        buffer_write_u8_unchecked(buf, f->invasion_id);
+        buffer_write_u8_unchecked(buf, f->herd_wolf_spawn_delay);
+        buffer_write_u8_unchecked(buf, f->herd_direction);
+        buffer_write_i32_unchecked(buf, f->target_formation_id);
         buffer_skip(buf, 13);
-        buffer_write_i16(buf, f->invasion_sequence);
+        buffer_write_i16_unchecked(buf, f->invasion_sequence);
     }
     buffer_write_i32(totals, data.id_last_in_use);
     buffer_write_i32(totals, data.id_last_legion);
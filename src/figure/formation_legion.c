@@ -8,6 +8,7 @@
 #include "figure/enemy_army.h"
 #include "figure/figure.h"
 #include "figure/route.h"
+#include "game/replay.h"
 #include "map/building.h"
 #include "map/figure.h"
 #include "map/grid.h"
@@ -92,6 +93,7 @@ void formation_legion_update_recruit_status(building *fort)
 
 void formation_legion_change_layout(formation *m, int new_layout)
 {
+    game_replay_record_command(REPLAY_COMMAND_CHANGE_LEGION_LAYOUT, m->id, new_layout, 0);
     if (new_layout == FORMATION_MOP_UP && m->layout != FORMATION_MOP_UP) {
         m->prev.layout = m->layout;
     }
@@ -118,6 +120,7 @@ static int prepare_to_move(formation *m)
 
 void formation_legion_move_to(formation *m, const map_tile *tile)
 {
+    game_replay_record_command(REPLAY_COMMAND_MOVE_LEGION, m->id, tile->x, tile->y);
     map_routing_calculate_distances(m->x_home, m->y_home);
     if (map_routing_distance(tile->grid_offset) <= 0) {
         return; // unable to route there
@@ -166,6 +169,7 @@ void formation_legion_move_to(formation *m, const map_tile *tile)
 
 void formation_legion_return_home(formation *m)
 {
+    game_replay_record_command(REPLAY_COMMAND_RETURN_LEGION_HOME, m->id, 0, 0);
     map_routing_calculate_distances(m->x_home, m->y_home);
     if (map_routing_distance(map_grid_offset(m->x, m->y)) <= 0) {
         return; // unable to route home
@@ -225,6 +229,7 @@ static int dispatch_soldiers(formation *m)
 
 void formation_legions_dispatch_to_distant_battle(void)
 {
+    game_replay_record_command(REPLAY_COMMAND_DISPATCH_TO_DISTANT_BATTLE, 0, 0, 0);
     int num_legions = 0;
     int roman_strength = 0;
     for (int i = 1; i < formation_count(); i++) {
@@ -2,14 +2,17 @@
 
 #include "building/industry.h"
 #include "building/properties.h"
+#include "building/roadblock.h"
 #include "building/rotation.h"
 #include "core/config.h"
+#include "core/hash.h"
 #include "figure/figure.h"
 #include "figure/movement.h"
 #include "figure/route.h"
 #include "map/building.h"
 #include "map/grid.h"
 #include "map/road_access.h"
+#include "map/road_network.h"
 
 #include <string.h>
 
@@ -21,6 +24,11 @@ static struct {
     grid_u8 travelled_tiles;
     building_type types[MAX_STORED_BUILDING_TYPES];
     int stored_building_types;
+    struct {
+        grid_u8 travelled_tiles;
+        int valid;
+        uint64_t key;
+    } other_roamers;
 } data;
 
 static figure_type building_type_to_figure_type(building_type type)
@@ -299,6 +307,61 @@ void figure_roamer_preview_create(building_type b_type, int x, int y)
     }
 }
 
+static uint64_t other_roamers_key(void)
+{
+    // The paths only change when the roads, the buildings sending the roamers, the roadblocks or the roaming rules
+    // change. Placing a roadblock on a road does not change the road network, so the roadblocks are hashed too.
+    // The road access of hippodromes also depends on the current building rotation.
+    hash_state state;
+    hash_init(&state, 0);
+    unsigned int generation = map_road_network_generation();
+    int settings[3] = {
+        config_get(CONFIG_GP_CH_ROAMERS_DONT_SKIP_CORNERS),
+        config_get(CONFIG_GP_CH_GLOBAL_LABOUR),
+        building_rotation_get_building_orientation(building_rotation_get_rotation())
+    };
+    hash_update(&state, &generation, sizeof(generation));
+    hash_update(&state, settings, sizeof(settings));
+    for (int i = 0; i < data.stored_building_types; i++) {
+        for (building *b = building_first_of_type(data.types[i]); b; b = b->next_of_type) {
+            int values[4] = { b->id, b->x, b->y, b->state };
+            hash_update(&state, values, sizeof(values));
+        }
+    }
+    for (building_type type = BUILDING_NONE; type < BUILDING_TYPE_MAX; type++) {
+        if (!building_type_is_roadblock(type)) {
+            continue;
+        }
+        for (building *b = building_first_of_type(type); b; b = b->next_of_type) {
+            int values[5] = { b->id, b->x, b->y, b->state, b->data.roadblock.exceptions };
+            hash_update(&state, values, sizeof(values));
+        }
+    }
+    return hash_digest(&state);
+}
+
+static void create_other_roamers(void)
+{
+    uint64_t key = other_roamers_key();
+    if (data.other_roamers.valid && data.other_roamers.key == key) {
+        memcpy(data.travelled_tiles.items, data.other_roamers.travelled_tiles.items, sizeof(data.travelled_tiles.items));
+        return;
+    }
+    for (int i = 0; i < data.stored_building_types; i++) {
+        for (building *b = building_first_of_type(data.types[i]); b; b = b->next_of_type) {
+            figure_roamer_preview_create(b->type, b->x, b->y);
+        }
+    }
+    memcpy(data.other_roamers.travelled_tiles.items, data.travelled_tiles.items, sizeof(data.travelled_tiles.items));
+    data.other_roamers.key = key;
+    data.other_roamers.valid = 1;
+}
+
+void figure_roamer_preview_invalidate(void)
+{
+    data.other_roamers.valid = 0;
+}
+
 void figure_roamer_preview_create_all_for_building_type(building_type type)
 {
     if (type == BUILDING_NONE) {
@@ -321,6 +384,7 @@ void figure_roamer_preview_create_all_for_building_type(building_type type)
     }
     data.types[data.stored_building_types] = type;
     data.stored_building_types++;
+    figure_roamer_preview_invalidate();
 }
 
 void figure_roamer_preview_reset(building_type type)
@@ -342,17 +406,14 @@ void figure_roamer_preview_reset(building_type type)
         }
     }
     if (show_other_roamers) {
-        for (int i = 0; i < data.stored_building_types; i++) {
-            for (building *b = building_first_of_type(data.types[i]); b; b = b->next_of_type) {
-                figure_roamer_preview_create(b->type, b->x, b->y);
-            }
-        }
+        create_other_roamers();
     }
 }
 
 void figure_roamer_preview_reset_building_types(void)
 {
     data.stored_building_types = 0;
+    figure_roamer_preview_invalidate();
     figure_roamer_preview_reset(BUILDING_NONE);
 }
 
@@ -13,6 +13,7 @@ void figure_roamer_preview_create(building_type b_type, int x, int y);
 void figure_roamer_preview_create_all_for_building_type(building_type type);
 void figure_roamer_preview_reset(building_type type);
 void figure_roamer_preview_reset_building_types(void);
+void figure_roamer_preview_invalidate(void);
 int figure_roamer_preview_get_frequency(int grid_offset);
 
 #endif // FIGURE_ROAMER_PREVIEW_H
@@ -5,17 +5,33 @@
 #include "map/routing.h"
 #include "map/routing_path.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 #define ARRAY_SIZE_STEP 600
 #define MAX_PATH_LENGTH 500
+#define POOL_SIZE_STEP 32768
 
 typedef struct {
     unsigned int id;
     int figure_id;
-    uint8_t directions[MAX_PATH_LENGTH];
+    unsigned int offset;
+    unsigned int length;
 } figure_path_data;
 
 static array(figure_path_data) paths;
 
+// The directions of all paths are stored one after the other in a shared pool,
+// which is compacted when too much of it is taken by paths that are no longer used
+static struct {
+    uint8_t *directions;
+    unsigned int size;
+    unsigned int capacity;
+    unsigned int unused;
+} pool;
+
+static uint8_t new_path_directions[MAX_PATH_LENGTH];
+
 static void create_new_path(figure_path_data *path, unsigned int position)
 {
     path->id = position;
@@ -26,10 +42,82 @@ static int path_is_used(const figure_path_data *path)
     return path->figure_id != 0;
 }
 
+static void free_path(figure_path_data *path)
+{
+    path->figure_id = 0;
+    pool.unused += path->length;
+    path->length = 0;
+}
+
+static void compact_pool(void)
+{
+    uint8_t *directions = malloc(pool.capacity);
+    if (!directions) {
+        return;
+    }
+    unsigned int size = 0;
+    figure_path_data *path;
+    array_foreach(paths, path) {
+        if (path->figure_id) {
+            memcpy(&directions[size], &pool.directions[path->offset], path->length);
+            path->offset = size;
+            size += path->length;
+        }
+    }
+    free(pool.directions);
+    pool.directions = directions;
+    pool.size = size;
+    pool.unused = 0;
+}
+
+static int reserve_pool(unsigned int length)
+{
+    if (pool.size + length <= pool.capacity) {
+        return 1;
+    }
+    if (pool.unused && pool.unused >= pool.size / 2) {
+        compact_pool();
+        if (pool.size + length <= pool.capacity) {
+            return 1;
+        }
+    }
+    unsigned int capacity = pool.capacity ? pool.capacity * 2 : POOL_SIZE_STEP;
+    while (capacity < pool.size + length) {
+        capacity *= 2;
+    }
+    uint8_t *directions = realloc(pool.directions, capacity);
+    if (!directions) {
+        log_error("Unable to allocate memory for figure paths", 0, 0);
+        return 0;
+    }
+    pool.directions = directions;
+    pool.capacity = capacity;
+    return 1;
+}
+
+static int store_path(figure_path_data *path, const uint8_t *directions, unsigned int length)
+{
+    if (!reserve_pool(length)) {
+        return 0;
+    }
+    memcpy(&pool.directions[pool.size], directions, length);
+    path->offset = pool.size;
+    path->length = length;
+    pool.size += length;
+    return 1;
+}
+
+static void clear_pool(void)
+{
+    pool.size = 0;
+    pool.unused = 0;
+}
+
 void figure_route_clear_all(void)
 {
     paths.size = 0;
     array_trim(paths);
+    clear_pool();
 }
 
 void figure_route_clean(void)
@@ -40,7 +128,7 @@ void figure_route_clean(void)
         if (figure_id > 0 && figure_id < figure_count()) {
             const figure *f = figure_get(figure_id);
             if (f->state != FIGURE_STATE_ALIVE || f->routing_path_id != array_index) {
-                path->figure_id = 0;
+                free_path(path);
             }
         }
     }
@@ -69,11 +157,11 @@ void figure_route_add(figure *f)
     if (f->is_boat) {
         if (f->is_boat == 2) { // flotsam
             map_routing_calculate_distances_water_flotsam(f->x, f->y);
-            path_length = map_routing_get_path_on_water(path->directions,
+            path_length = map_routing_get_path_on_water(new_path_directions,
                 f->destination_x, f->destination_y, 1);
         } else {
             map_routing_calculate_distances_water_boat(f->x, f->y);
-            path_length = map_routing_get_path_on_water(path->directions,
+            path_length = map_routing_get_path_on_water(new_path_directions,
                 f->destination_x, f->destination_y, 0);
         }
     } else {
@@ -132,20 +220,20 @@ void figure_route_add(figure *f)
         }
         if (can_travel) {
             if (f->terrain_usage == TERRAIN_USAGE_WALLS) {
-                path_length = map_routing_get_path(path->directions, f->destination_x, f->destination_y, 4);
+                path_length = map_routing_get_path(new_path_directions, f->destination_x, f->destination_y, 4);
                 if (path_length <= 0) {
-                    path_length = map_routing_get_path(path->directions,
+                    path_length = map_routing_get_path(new_path_directions,
                         f->destination_x, f->destination_y, direction_limit);
                 }
             } else {
-                path_length = map_routing_get_path(path->directions,
+                path_length = map_routing_get_path(new_path_directions,
                     f->destination_x, f->destination_y, direction_limit);
             }
         } else { // cannot travel
             path_length = 0;
         }
     }
-    if (path_length) {
+    if (path_length && store_path(path, new_path_directions, path_length)) {
         path->figure_id = f->id;
         f->routing_path_id = path->id;
         f->routing_path_length = path_length;
@@ -156,7 +244,7 @@ void figure_route_remove(figure *f)
 {
     if (f->routing_path_id > 0) {
         if (f->routing_path_id < paths.size && array_item(paths, f->routing_path_id)->figure_id == f->id) {
-            array_item(paths, f->routing_path_id)->figure_id = 0;
+            free_path(array_item(paths, f->routing_path_id));
         }
         f->routing_path_id = 0;
     }
@@ -165,7 +253,11 @@ void figure_route_remove(figure *f)
 
 int figure_route_get_direction(int path_id, int index)
 {
-    return array_item(paths, path_id)->directions[index];
+    const figure_path_data *path = array_item(paths, path_id);
+    if (index < 0 || (unsigned int) index >= path->length) {
+        return DIR_FIGURE_LOST;
+    }
+    return pool.directions[path->offset + index];
 }
 
 void figure_route_save_state(buffer *figures, buffer *buf_paths)
@@ -174,21 +266,37 @@ void figure_route_save_state(buffer *figures, buffer *buf_paths)
     uint8_t *buf_data = malloc(size);
     buffer_init(figures, buf_data, size);
 
+    // Paths are saved with a fixed length, the directions after the end of a path are left empty
     size = paths.size * sizeof(uint8_t) * MAX_PATH_LENGTH;
-    buf_data = malloc(size);
+    buf_data = calloc(size, 1);
     buffer_init(buf_paths, buf_data, size);
 
     figure_path_data *path;
     array_foreach(paths, path) {
         buffer_write_i16(figures, path->figure_id);
-        buffer_write_raw(buf_paths, path->directions, MAX_PATH_LENGTH);
+        buffer_write_raw(buf_paths, &pool.directions[path->offset], path->length);
+        buffer_skip(buf_paths, MAX_PATH_LENGTH - path->length);
+    }
+}
+
+static unsigned int get_loaded_path_length(int path_id, int figure_id)
+{
+    if (figure_id > 0 && figure_id < figure_count()) {
+        const figure *f = figure_get(figure_id);
+        if (f->routing_path_id == path_id && f->routing_path_length > 0 &&
+            f->routing_path_length <= MAX_PATH_LENGTH) {
+            return f->routing_path_length;
+        }
     }
+    // Keep the full path when it is not clear how much of it is used
+    return MAX_PATH_LENGTH;
 }
 
 void figure_route_load_state(buffer *figures, buffer *buf_paths)
 {
     int elements_to_load = (int) buf_paths->size / MAX_PATH_LENGTH;
 
+    clear_pool();
     if (!array_init(paths, ARRAY_SIZE_STEP, create_new_path, path_is_used) ||
         !array_expand(paths, elements_to_load)) {
         log_error("Unable to create paths array. The game will likely crash.", 0, 0);
@@ -200,8 +308,9 @@ void figure_route_load_state(buffer *figures, buffer *buf_paths)
     for (int i = 0; i < elements_to_load; i++) {
         figure_path_data *path = array_next(paths);
         path->figure_id = buffer_read_i16(figures);
-        buffer_read_raw(buf_paths, path->directions, MAX_PATH_LENGTH);
+        buffer_read_raw(buf_paths, new_path_directions, MAX_PATH_LENGTH);
         if (path->figure_id) {
+            store_path(path, new_path_directions, get_loaded_path_length(i, path->figure_id));
             highest_id_in_use = i;
         }
     }
@@ -14,6 +14,7 @@
 #include "figure/image.h"
 #include "figure/movement.h"
 #include "figure/route.h"
+#include "game/replay.h"
 #include "map/figure.h"
 #include "map/grid.h"
 #include "map/point.h"
@@ -289,6 +290,8 @@ void figure_animal_try_nudge_at(int building_center_tile_grid_offset, int animal
             if (terrain_blocked_for_animals(target_grid_offset)) {
                 continue;
             }
+            game_replay_record_command(REPLAY_COMMAND_NUDGE_ANIMAL,
+                building_center_tile_grid_offset, animal_tile_offset, building_size);
             f->action_state = FIGURE_ACTION_197_HERD_ANIMAL_MOVING;
             f->destination_x = map_grid_offset_to_x(target_grid_offset);
             f->destination_y = map_grid_offset_to_y(target_grid_offset);
@@ -13,6 +13,7 @@
 #include "figure/image.h"
 #include "figure/movement.h"
 #include "figure/route.h"
+#include "map/figure.h"
 #include "map/grid.h"
 #include "map/road_access.h"
 #include "map/road_network.h"
@@ -322,6 +323,7 @@ void figure_entertainer_action(figure *f)
             f->action_state == FIGURE_ACTION_94_ENTERTAINER_ROAMING ||
             f->action_state == FIGURE_ACTION_95_ENTERTAINER_RETURNING) {
             f->type = FIGURE_ENEMY54_GLADIATOR;
+            map_figure_update_category(f);
             figure_route_remove(f);
             f->roam_length = 0;
             f->action_state = FIGURE_ACTION_158_NATIVE_CREATED;
@@ -352,10 +352,25 @@ static int get_closest_storage(const figure *f, int x, int y, int city_id, map_p
     int permissions = f->type == FIGURE_NATIVE_TRADER ? BUILDING_STORAGE_PERMISSION_NATIVES : BUILDING_STORAGE_PERMISSION_TRADERS;
     int sell_capacity = max_trade_units - f->loads_sold_or_carrying;
     int buy_capacity = max_trade_units - f->trader_amount_bought;
+    // 2. Only the resources that can be traded need to be checked for each building
+    int tradeable_resources[2][RESOURCE_MAX];
+    int num_tradeable_resources[2] = { 0, 0 };
+    for (int r = RESOURCE_MIN; r < RESOURCE_MAX; r++) {
+        if ((sellable[r] > 0 && sell_capacity > 0) || (buyable[r] > 0 && buy_capacity > 0)) {
+            if (resource_is_food(r)) {
+                tradeable_resources[0][num_tradeable_resources[0]++] = r;
+            }
+            tradeable_resources[1][num_tradeable_resources[1]++] = r;
+        }
+    }
+    const map_tile *exit = city_map_exit_point();
     int best_score = -1;
     int building_types[] = { BUILDING_GRANARY, BUILDING_WAREHOUSE };
     int best_building_id = 0;
     for (int t = 0; t < 2; t++) {
+        if (!num_tradeable_resources[t]) {
+            continue; // No building of this type can score above zero
+        }
         // Loop over all buildings of the current type (granary or warehouse)
         for (building *b = building_first_of_type(building_types[t]); b; b = b->next_of_type) {
             // Skip buildings
@@ -366,11 +381,9 @@ static int get_closest_storage(const figure *f, int x, int y, int city_id, map_p
             }
             int sell_score = 0; // Score for how many units the trader can sell to this building
             int buy_score = 0;  // Score for how many units the trader can buy from this building
-            // Loop through all resource types
-            for (int r = RESOURCE_MIN; r < RESOURCE_MAX; r++) {
-                if (building_types[t] == BUILDING_GRANARY && !resource_is_food(r)) {
-                    continue;
-                }
+            // Loop through the tradeable resource types, granaries only store food
+            for (int i = 0; i < num_tradeable_resources[t]; i++) {
+                int r = tradeable_resources[t][i];
                 // === SELL SCORING: Trader -> Building ===
                 if (sellable[r] > 0 && sell_capacity > 0) {
                     // Get how much of this resource the building can accept
@@ -394,7 +407,6 @@ static int get_closest_storage(const figure *f, int x, int y, int city_id, map_p
                     buy_score += can_take; // Add this to the total buy score
                 }
             }
-            const map_tile *exit = city_map_exit_point();
             int raw_distance = map_grid_chess_distance(f->grid_offset, b->grid_offset);
             if (route_id == 0 && f->type == FIGURE_NATIVE_TRADER) {
                 raw_distance += raw_distance; //native traders always return home after 1 trade, so double the distance
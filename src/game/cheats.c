@@ -4,6 +4,7 @@
 #include "building/menu.h"
 #include "building/monument.h"
 #include "building/type.h"
+#include "building/warehouse.h"
 #include "city/gods.h"
 #include "city/finance.h"
 #include "city/data_private.h"
@@ -12,10 +13,13 @@
 #include "city/warning.h"
 #include "core/config.h"
 #include "core/lang.h"
+#include "core/log.h"
 #include "core/string.h"
 #include "empire/city.h"
 #include "figure/figure.h"
 #include "figuretype/crime.h"
+#include "game/replay.h"
+#include "game/state_hash.h"
 #include "game/tick.h"
 #include "graphics/color.h"
 #include "graphics/font.h"
@@ -56,6 +60,11 @@ static void game_cheat_unlock_legions(uint8_t *);
 static void game_cheat_disable_legions_consumption(uint8_t *);
 static void game_cheat_disable_invasions(uint8_t *);
 static void game_cheat_change_weather(uint8_t *);
+static void game_cheat_start_replay_recording(uint8_t *);
+static void game_cheat_stop_replay_recording(uint8_t *);
+static void game_cheat_play_replay(uint8_t *);
+static void game_cheat_log_state_hash(uint8_t *);
+static void game_cheat_check_warehouses(uint8_t *);
 
 static void (*const execute_command[])(uint8_t *args) = {
     game_cheat_add_money,
@@ -77,6 +86,11 @@ static void (*const execute_command[])(uint8_t *args) = {
     game_cheat_disable_legions_consumption,
     game_cheat_disable_invasions,
     game_cheat_change_weather,
+    game_cheat_start_replay_recording,
+    game_cheat_stop_replay_recording,
+    game_cheat_play_replay,
+    game_cheat_log_state_hash,
+    game_cheat_check_warehouses,
 };
 
 static const char *commands[] = {
@@ -98,7 +112,12 @@ static const char *commands[] = {
     "ihaveanarmy",
     "breadandfish",
     "leavemealone",
-    "weather"
+    "weather",
+    "debug.record",
+    "debug.stoprecord",
+    "debug.replay",
+    "debug.statehash",
+    "debug.checkwarehouses"
 };
 
 #define NUMBER_OF_COMMANDS sizeof (commands) / sizeof (commands[0])
@@ -173,6 +192,7 @@ int game_cheat_tooltip_enabled(void)
 void game_cheat_money(void)
 {
     if (data.is_cheating) {
+        game_replay_record_unjournaled("cheat");
         city_finance_process_cheat();
         window_invalidate();
     }
@@ -181,6 +201,7 @@ void game_cheat_money(void)
 void game_cheat_victory(void)
 {
     if (data.is_cheating) {
+        game_replay_record_unjournaled("cheat");
         city_victory_force_win();
     }
 }
@@ -207,6 +228,7 @@ static void show_warning(translation_key key)
 
 static void game_cheat_add_money(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     int money = 0;
     parse_integer(args, &money);
     city_finance_process_console(money);
@@ -216,6 +238,7 @@ static void game_cheat_add_money(uint8_t *args)
 
 static void game_cheat_start_invasion(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     int invasion_type = 0;
     int size = 0;
     int invasion_point = 0;
@@ -228,12 +251,14 @@ static void game_cheat_start_invasion(uint8_t *args)
 
 static void game_cheat_advance_year(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     game_tick_cheat_year();
     show_warning(TR_CHEAT_YEAR_ADVANCED);
 }
 
 static void game_cheat_cast_blessing(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     int god_id = 0;
     parse_integer(args, &god_id);
     city_god_blessing(god_id);
@@ -242,6 +267,7 @@ static void game_cheat_cast_blessing(uint8_t *args)
 
 static void game_cheat_cast_curse(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     int god_id = 0;
     int is_major = 0;
     int index = parse_integer(args, &god_id);
@@ -252,12 +278,14 @@ static void game_cheat_cast_curse(uint8_t *args)
 
 static void game_cheat_make_buildings_invincible(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     building_make_immune_cheat();
     show_warning(TR_CHEAT_BUILDINGS_INVINCIBLE);
 }
 
 static void game_cheat_change_climate(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     int climate = 0;
     parse_integer(args, &climate);
     scenario_change_climate(climate);
@@ -272,18 +300,21 @@ static void game_cheat_show_tooltip(uint8_t *args)
 
 static void game_cheat_kill_all(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     figure_kill_all();
     show_warning(TR_CHEAT_KILLED_ALL_WALKERS);
 }
 
 static void game_cheat_finish_monuments(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     building_monument_finish_monuments();
     show_warning(TR_CHEAT_FINISHED_MONUMENTS);
 }
 
 static void game_cheat_set_monument_phase(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     int phase = 0;
     parse_integer(args, &phase);
     building_monuments_set_construction_phase(phase);
@@ -292,6 +323,7 @@ static void game_cheat_set_monument_phase(uint8_t *args)
 
 static void game_cheat_unlock_all_buildings(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     building_menu_enable_all();
     empire_unlock_all_resources();
     scenario_unlock_all_buildings();
@@ -300,18 +332,21 @@ static void game_cheat_unlock_all_buildings(uint8_t *args)
 
 static void game_cheat_unlock_legions(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     data.extra_legions_unlocked = 1;
     show_warning(TR_CHEAT_UNLOCK_LEGIONS);
 }
 
 static void game_cheat_disable_legions_consumption(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     data.disabled_legions_consumption = 1;
     show_warning(TR_CHEAT_DISABLE_LEGIONS_CONSUMPTION);
 }
 
 static void game_cheat_disable_invasions(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     data.disabled_invasions = 1;
     scenario_invasion_clear();
     show_warning(TR_CHEAT_DISABLE_INVASIONS);
@@ -319,6 +354,7 @@ static void game_cheat_disable_invasions(uint8_t *args)
 
 static void game_cheat_incite_riot(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     city_data.sentiment.value = 0;
     city_sentiment_change_happiness(-100);
     figure_generate_criminals();
@@ -343,6 +379,7 @@ static void game_cheat_show_editor(uint8_t *args)
 
 static void game_cheat_change_weather(uint8_t *args)
 {
+    game_replay_record_unjournaled("cheat");
     int weather = WEATHER_NONE; //is actually weather type so either 0(WEATHER_NONE), 1(RAIN), 2(SNOW), 3(SAND)
     int intensity = 0; //note that intesity only changes particles for Thunder set weather to rain with intesity higher ca. 900, rain sounds start at 500
     int index = parse_integer(args, &weather);
@@ -354,10 +391,57 @@ static void game_cheat_change_weather(uint8_t *args)
     show_warning(TR_CHEAT_CHANGE_WEATHER);
 }
 
+static void parse_replay_name(uint8_t *args, char *name)
+{
+    parse_word(args, (uint8_t *) name);
+    if (!*name) {
+        strcpy(name, "replay");
+    }
+}
+
+static void game_cheat_start_replay_recording(uint8_t *args)
+{
+    char name[MAX_COMMAND_SIZE];
+    parse_replay_name(args, name);
+    game_replay_start_recording(name);
+}
+
+static void game_cheat_stop_replay_recording(uint8_t *args)
+{
+    game_replay_stop_recording();
+}
+
+static void game_cheat_play_replay(uint8_t *args)
+{
+    char name[MAX_COMMAND_SIZE];
+    parse_replay_name(args, name);
+    game_replay_play(name);
+}
+
+static void game_cheat_log_state_hash(uint8_t *args)
+{
+    state_hash hash;
+    game_state_hash_calculate(&hash);
+    game_state_hash_log(&hash);
+}
+
+static void game_cheat_check_warehouses(uint8_t *args)
+{
+    int mismatches = building_warehouses_check_resources();
+    if (mismatches) {
+        log_error("Warehouses with wrong resource totals:", 0, mismatches);
+    } else {
+        log_info("All warehouse resource totals match their spaces", 0, 0);
+    }
+}
+
 void game_cheat_parse_command(uint8_t *command)
 {
     uint8_t command_to_call[MAX_COMMAND_SIZE];
     int next_arg = parse_word(command, command_to_call);
+    if (!command[next_arg - 1]) {
+        next_arg--; // no arguments: point to the terminator instead of past it
+    }
     for (int i = 0; i < NUMBER_OF_COMMANDS; i++) {
         if (strcmp((char *) command_to_call, commands[i]) == 0) {
             (*execute_command[i])(command + next_arg);
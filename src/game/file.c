@@ -6,6 +6,7 @@
 #include "building/menu.h"
 #include "building/monument.h"
 #include "building/storage.h"
+#include "building/warehouse.h"
 #include "city/data.h"
 #include "city/emperor.h"
 #include "city/map.h"
@@ -277,6 +278,7 @@ static void initialize_saved_game(void)
 
     city_view_init();
 
+    map_road_network_clear();
     map_routing_update_all();
 
     map_orientation_update_buildings();
@@ -285,6 +287,7 @@ static void initialize_saved_game(void)
     map_routing_update_land();
     building_maintenance_check_rome_access();
     building_granaries_calculate_stocks();
+    building_warehouses_recount_resources();
     building_menu_update();
     city_message_init_problem_areas();
 
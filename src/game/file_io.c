@@ -12,6 +12,7 @@
 #include "city/view.h"
 #include "core/dir.h"
 #include "core/file.h"
+#include "core/hash.h"
 #include "core/log.h"
 #include "core/memory_block.h"
 #include "core/random.h"
@@ -76,11 +77,13 @@
 #define GRID_SIZE_BUF_U8 GRID_SIZE * GRID_SIZE
 #define GRID_SIZE_BUF_U16 GRID_SIZE * GRID_SIZE * 2
 #define GRID_SIZE_BUF_U32 GRID_SIZE * GRID_SIZE * 4
+#define FILE_INFO_CACHE_SIZE 16
 
 typedef struct {
     buffer buf;
     int compressed;
     int dynamic;
+    int is_view; // buf points into the data that is being loaded and must not be freed
 } file_piece;
 
 typedef struct {
@@ -290,6 +293,17 @@ static struct {
     savegame_state state;
 } savegame_data;
 
+typedef struct {
+    uint64_t hash;
+    size_t uncompressed_size;
+    int compressed_size;
+    memory_block compressed;
+} compressed_piece;
+
+static struct {
+    compressed_piece pieces[sizeof(savegame_state) / sizeof(buffer *) + 1];
+} compressed_savegame_pieces;
+
 static struct {
     minimap_functions functions;
     savegame_version_t version;
@@ -299,10 +313,30 @@ static struct {
     scenario_climate climate;
 } minimap_data;
 
+typedef struct {
+    char filename[FILE_NAME_MAX];
+    unsigned int modified_time;
+    int status;
+    saved_game_info info;
+    minimap_functions minimap_functions;
+    savegame_version_t minimap_version;
+    int city_width;
+    int city_height;
+    scenario_climate climate;
+    color_t *minimap;
+    unsigned int last_used;
+} file_info_cache_entry;
+
+static struct {
+    file_info_cache_entry entries[FILE_INFO_CACHE_SIZE];
+    unsigned int use_count;
+} file_info_cache;
+
 static void init_file_piece(file_piece *piece, int size, int compressed)
 {
     piece->compressed = compressed;
     piece->dynamic = size == PIECE_SIZE_DYNAMIC;
+    piece->is_view = 0;
     if (piece->dynamic) {
         buffer_init(&piece->buf, 0, 0);
     } else {
@@ -330,7 +364,9 @@ static void clear_savegame_pieces(void)
 {
     for (int i = 0; i < savegame_data.num_pieces; i++) {
         buffer_reset(&savegame_data.pieces[i].buf);
-        free(savegame_data.pieces[i].buf.data);
+        if (!savegame_data.pieces[i].is_view) {
+            free(savegame_data.pieces[i].buf.data);
+        }
         savegame_data.pieces[i].buf.data = 0;
     }
     savegame_data.num_pieces = 0;
@@ -977,41 +1013,6 @@ static void savegame_save_to_state(savegame_state *state)
     figure_visited_buildings_save_state(state->visited_buildings);
 }
 
-static int get_scenario_version(FILE *fp)
-{
-    char version_magic[8];
-    size_t read = fread(version_magic, 1, 8, fp);
-    if (read != sizeof(version_magic)) {
-        log_error("Unable to read version header from file", 0, 0);
-        return 0;
-    }
-    if (strcmp(version_magic, "VERSION") != 0) {
-        rewind(fp);
-        return SCENARIO_LAST_UNVERSIONED;
-    }
-
-    buffer buf;
-    uint8_t version_data[4];
-    buffer_init(&buf, version_data, 4);
-    read = fread(version_data, 1, 4, fp);
-    if (read != sizeof(version_data)) {
-        log_error("Unable to read version number from file", 0, 0);
-        return 0;
-    }
-    return buffer_read_i32(&buf);
-}
-
-static int read_int32(FILE *fp)
-{
-    uint8_t data[4];
-    if (fread(&data, 1, 4, fp) != 4) {
-        return 0;
-    }
-    buffer buf;
-    buffer_init(&buf, data, 4);
-    return buffer_read_i32(&buf);
-}
-
 static void write_int32(FILE *fp, int value)
 {
     uint8_t data[4];
@@ -1021,59 +1022,28 @@ static void write_int32(FILE *fp, int value)
     fwrite(&data, 1, 4, fp);
 }
 
-static int read_compressed_chunk_from_buffer(buffer *buf, void *dst, size_t bytes_to_read, int read_as_zlib,
-    memory_block *compress_buffer)
+static int read_compressed_chunk_from_buffer(buffer *buf, void *dst, size_t bytes_to_read, int read_as_zlib)
 {
     int input_size = buffer_read_i32(buf);
     if ((unsigned int) input_size == UNCOMPRESSED) {
         return buffer_read_raw(buf, dst, (int) bytes_to_read) == bytes_to_read;
     } else {
-        if (!core_memory_block_ensure_size(compress_buffer, input_size)) {
-            return 0;
-        }
-        if (buffer_read_raw(buf, compress_buffer->memory, input_size) != input_size) {
+        if (input_size < 0 || buf->size - buf->index < (size_t) input_size) {
             return 0;
         }
+        // Decompress straight from the loaded data, without copying the compressed bytes first
+        uint8_t *input = buf->data + buf->index;
+        buffer_skip(buf, input_size);
 
         if (!read_as_zlib) {
-            return zip_decompress(compress_buffer->memory, input_size, dst, (int) bytes_to_read);
+            return zip_decompress(input, input_size, dst, (int) bytes_to_read);
         } else {
             int output_size = 0;
-            return zlib_helper_decompress(compress_buffer->memory, input_size, dst, (int) bytes_to_read, &output_size);
+            return zlib_helper_decompress(input, input_size, dst, (int) bytes_to_read, &output_size);
         }
     }
 }
 
-static int read_compressed_chunk(FILE *fp, void *dst, size_t bytes_to_read, int read_as_zlib,
-    memory_block *compress_buffer)
-{
-    int input_size = read_int32(fp);
-    if ((unsigned int) input_size == UNCOMPRESSED) {
-        return fread(dst, 1, bytes_to_read, fp) == bytes_to_read;
-    } else {
-        if (!core_memory_block_ensure_size(compress_buffer, input_size)) {
-            return 0;
-        }
-        if (fread(compress_buffer->memory, 1, input_size, fp) != input_size) {
-            return 0;
-        }
-
-        if (!read_as_zlib) {
-            return zip_decompress(compress_buffer->memory, input_size, dst, (int) bytes_to_read);
-        } else {
-            int output_size = 0;
-            return zlib_helper_decompress(compress_buffer->memory, input_size, dst, (int) bytes_to_read, &output_size);
-        }
-    }
-}
-
-static int read_compressed_savegame_chunk(FILE *fp, void *buf, size_t bytes_to_read,
-    savegame_version_t version, memory_block *compress_buffer)
-{
-    int read_as_zlib = version > SAVE_GAME_LAST_ZIP_COMPRESSION;
-    return read_compressed_chunk(fp, buf, bytes_to_read, read_as_zlib, compress_buffer);
-}
-
 static int write_compressed_chunk(FILE *fp, void *buf, size_t bytes_to_write, memory_block *compress_buffer)
 {
     if (!core_memory_block_ensure_size(compress_buffer, bytes_to_write)) {
@@ -1091,10 +1061,10 @@ static int write_compressed_chunk(FILE *fp, void *buf, size_t bytes_to_write, me
     return 1;
 }
 
-static int prepare_dynamic_piece_from_file(FILE *fp, file_piece *piece)
+static int prepare_dynamic_piece_from_buffer(buffer *buf, file_piece *piece)
 {
     if (piece->dynamic) {
-        int size = read_int32(fp);
+        int size = buffer_read_i32(buf);
         if (!size) {
             return 0;
         }
@@ -1105,17 +1075,30 @@ static int prepare_dynamic_piece_from_file(FILE *fp, file_piece *piece)
     return 1;
 }
 
-static int prepare_dynamic_piece_from_buffer(buffer *buf, file_piece *piece)
+static int read_file_to_buffer(const char *filename, int offset, memory_block *file_data, buffer *buf)
 {
-    if (piece->dynamic) {
-        int size = buffer_read_i32(buf);
-        if (!size) {
-            return 0;
-        }
-        uint8_t *data = malloc(size);
-        memset(data, 0, size);
-        buffer_init(&piece->buf, data, size);
+    FILE *fp = file_open(filename, "rb");
+    if (!fp) {
+        return 0;
+    }
+    long size = -1;
+    if (fseek(fp, 0, SEEK_END) == 0) {
+        size = ftell(fp) - offset;
     }
+    if (size < 0 || fseek(fp, offset, SEEK_SET) != 0) {
+        file_close(fp);
+        return 0;
+    }
+    file_data->memory = 0;
+    file_data->size = 0;
+    if (!core_memory_block_ensure_size(file_data, size ? size : 1) ||
+        fread(file_data->memory, 1, size, fp) != (size_t) size) {
+        core_memory_block_free(file_data);
+        file_close(fp);
+        return 0;
+    }
+    file_close(fp);
+    buffer_init(buf, file_data->memory, (int) size);
     return 1;
 }
 
@@ -1143,8 +1126,6 @@ static int load_scenario_from_buffer(buffer *buf)
         log_error("Scenario version incompatible with current version, got version", 0, version);
         return 0;
     }
-    memory_block compress_buffer;
-    core_memory_block_init(&compress_buffer, COMPRESS_BUFFER_INITIAL_SIZE);
     for (int i = 0; i < scenario_data.num_pieces; i++) {
         file_piece *piece = &scenario_data.pieces[i];
         int result = 0;
@@ -1152,58 +1133,30 @@ static int load_scenario_from_buffer(buffer *buf)
             continue;
         }
         if (piece->compressed) {
-            result = read_compressed_chunk_from_buffer(buf, piece->buf.data, piece->buf.size, 1, &compress_buffer);
+            result = read_compressed_chunk_from_buffer(buf, piece->buf.data, piece->buf.size, 1);
         } else {
             result = buffer_read_raw(buf, piece->buf.data, piece->buf.size) == piece->buf.size;
         }
         if (!result) {
             log_info("Incorrect buffer size, got", 0, result);
             log_info("Incorrect buffer size, expected", 0, (int) piece->buf.size);
-            core_memory_block_free(&compress_buffer);
             return 0;
         }
     }
-    core_memory_block_free(&compress_buffer);
     return 1;
 }
 
 static int load_scenario_to_buffers(const char *filename)
 {
-    FILE *fp = file_open(filename, "rb");
-    if (!fp) {
-        return 0;
-    }
-    scenario_version_t version = get_scenario_version(fp);
-    init_scenario_data(version);
-    if (version > SCENARIO_CURRENT_VERSION) {
-        log_error("Scenario version incompatible with current version, got version", 0, version);
+    memory_block file_data;
+    buffer buf;
+    if (!read_file_to_buffer(filename, 0, &file_data, &buf)) {
         return 0;
     }
-    memory_block compress_buffer;
-    core_memory_block_init(&compress_buffer, COMPRESS_BUFFER_INITIAL_SIZE);
-    for (int i = 0; i < scenario_data.num_pieces; i++) {
-        file_piece *piece = &scenario_data.pieces[i];
-        int result = 0;
-        if (!prepare_dynamic_piece_from_file(fp, piece)) {
-            continue;
-        }
-        if (piece->compressed) {
-            result = read_compressed_chunk(fp, piece->buf.data, piece->buf.size, 1, &compress_buffer);
-        } else {
-            size_t bytes_read = fread(piece->buf.data, 1, piece->buf.size, fp);
-            result = bytes_read == piece->buf.size;
-        }
-        if (!result) {
-            log_info("Incorrect buffer size, got", 0, result);
-            log_info("Incorrect buffer size, expected", 0, (int) piece->buf.size);
-            file_close(fp);
-            core_memory_block_free(&compress_buffer);
-            return 0;
-        }
-    }
-    core_memory_block_free(&compress_buffer);
-    file_close(fp);
-    return 1;
+    // Scenario pieces are kept after loading, so they are copied rather than pointing into the file data
+    int result = load_scenario_from_buffer(&buf);
+    core_memory_block_free(&file_data);
+    return result;
 }
 
 int game_file_io_read_scenario_from_buffer(buffer *buf)
@@ -1245,6 +1198,22 @@ static int scenario_random_at(int grid_offset)
     return map_random_get_from_buffer(scenario_data.state.random, grid_offset);
 }
 
+static void clear_file_info_cache_entry(file_info_cache_entry *entry)
+{
+    free(entry->minimap);
+    memset(entry, 0, sizeof(file_info_cache_entry));
+}
+
+static void forget_cached_file_info(const char *filename)
+{
+    for (int i = 0; i < FILE_INFO_CACHE_SIZE; i++) {
+        file_info_cache_entry *entry = &file_info_cache.entries[i];
+        if (entry->last_used && strcmp(entry->filename, filename) == 0) {
+            clear_file_info_cache_entry(entry);
+        }
+    }
+}
+
 static scenario_climate get_climate(void)
 {
     return minimap_data.climate;
@@ -1354,6 +1323,7 @@ int game_file_io_read_scenario_info_from_buffer(buffer *buf, saved_game_info *in
 int game_file_io_write_scenario(const char *filename)
 {
     log_info("Saving scenario", filename, 0);
+    forget_cached_file_info(filename);
     resource_set_mapping(RESOURCE_CURRENT_VERSION);
     init_scenario_data(SCENARIO_CURRENT_VERSION);
     scenario_save_to_state(&scenario_data.state);
@@ -1388,10 +1358,23 @@ int game_file_io_write_scenario(const char *filename)
     return 1;
 }
 
+static int use_piece_in_place(buffer *buf, file_piece *piece)
+{
+    if (buf->size - buf->index < piece->buf.size) {
+        return 0;
+    }
+    free(piece->buf.data);
+    buffer_init(&piece->buf, buf->data + buf->index, (int) piece->buf.size);
+    piece->is_view = 1;
+    buffer_skip(buf, piece->buf.size);
+    return 1;
+}
+
+/**
+ * Uncompressed pieces point into buf, which must stay valid until the pieces are cleared
+ */
 static int savegame_read_from_buffer(buffer *buf, savegame_version_t version)
 {
-    memory_block compress_buffer;
-    core_memory_block_init(&compress_buffer, COMPRESS_BUFFER_INITIAL_SIZE);
     for (int i = 0; i < savegame_data.num_pieces; i++) {
         file_piece *piece = &savegame_data.pieces[i];
         size_t result = 0;
@@ -1400,7 +1383,9 @@ static int savegame_read_from_buffer(buffer *buf, savegame_version_t version)
         }
         if (piece->compressed) {
             result = read_compressed_chunk_from_buffer(buf, piece->buf.data, piece->buf.size,
-                version > SAVE_GAME_LAST_ZIP_COMPRESSION, &compress_buffer);
+                version > SAVE_GAME_LAST_ZIP_COMPRESSION);
+        } else if (use_piece_in_place(buf, piece)) {
+            result = 1;
         } else {
             result = buffer_read_raw(buf, piece->buf.data, piece->buf.size) == piece->buf.size;
         }
@@ -1408,39 +1393,44 @@ static int savegame_read_from_buffer(buffer *buf, savegame_version_t version)
         if (!result && i != (savegame_data.num_pieces - 1)) {
             log_info("Incorrect buffer size, got", 0, (int) result);
             log_info("Incorrect buffer size, expected", 0, (int) piece->buf.size);
-            core_memory_block_free(&compress_buffer);
             return 0;
         }
     }
-    core_memory_block_free(&compress_buffer);
     return 1;
 }
 
-static int savegame_read_from_file(FILE *fp, savegame_version_t version)
+static void write_compressed_savegame_piece(FILE *fp, int index, memory_block *compress_buffer)
 {
-    memory_block compress_buffer;
-    core_memory_block_init(&compress_buffer, COMPRESS_BUFFER_INITIAL_SIZE);
-    for (int i = 0; i < savegame_data.num_pieces; i++) {
-        file_piece *piece = &savegame_data.pieces[i];
-        int result = 0;
-        if (!prepare_dynamic_piece_from_file(fp, piece)) {
-            continue;
-        }
-        if (piece->compressed) {
-            result = read_compressed_savegame_chunk(fp, piece->buf.data, piece->buf.size, version, &compress_buffer);
-        } else {
-            result = fread(piece->buf.data, 1, piece->buf.size, fp) == piece->buf.size;
-        }
-        // The last piece may be smaller than buf.size
-        if (!result && i != (savegame_data.num_pieces - 1)) {
-            log_info("Incorrect buffer size, got", 0, result);
-            log_info("Incorrect buffer size, expected", 0, (int) piece->buf.size);
-            core_memory_block_free(&compress_buffer);
-            return 0;
+    const file_piece *piece = &savegame_data.pieces[index];
+    compressed_piece *cached = &compressed_savegame_pieces.pieces[index];
+    uint64_t hash = hash_data(piece->buf.data, piece->buf.size, 0);
+
+    // Most pieces, like the scenario and most grids, do not change between saves: reuse the compressed data
+    if (cached->compressed_size && cached->uncompressed_size == piece->buf.size && cached->hash == hash) {
+        write_int32(fp, cached->compressed_size);
+        fwrite(cached->compressed.memory, 1, cached->compressed_size, fp);
+        return;
+    }
+    cached->compressed_size = 0;
+    if (!core_memory_block_ensure_size(compress_buffer, piece->buf.size)) {
+        return;
+    }
+    int output_size = 0;
+    if (zlib_helper_compress(piece->buf.data, (int) piece->buf.size, compress_buffer->memory,
+            COMPRESS_BUFFER_INITIAL_SIZE, &output_size)) {
+        write_int32(fp, output_size);
+        fwrite(compress_buffer->memory, 1, output_size, fp);
+        if (core_memory_block_ensure_size(&cached->compressed, output_size)) {
+            memcpy(cached->compressed.memory, compress_buffer->memory, output_size);
+            cached->compressed_size = output_size;
+            cached->uncompressed_size = piece->buf.size;
+            cached->hash = hash;
         }
+    } else {
+        // unable to compress: write uncompressed
+        write_int32(fp, UNCOMPRESSED);
+        fwrite(piece->buf.data, 1, piece->buf.size, fp);
     }
-    core_memory_block_free(&compress_buffer);
-    return 1;
 }
 
 static void savegame_write_to_file(FILE *fp, memory_block *compress_buffer)
@@ -1454,7 +1444,7 @@ static void savegame_write_to_file(FILE *fp, memory_block *compress_buffer)
             }
         }
         if (piece->compressed) {
-            write_compressed_chunk(fp, piece->buf.data, piece->buf.size, compress_buffer);
+            write_compressed_savegame_piece(fp, i, compress_buffer);
         } else {
             fwrite(piece->buf.data, 1, piece->buf.size, fp);
         }
@@ -1475,33 +1465,6 @@ static int get_savegame_versions_from_buffer(buffer *buf, savegame_version_t *sa
     return *save_version != 0;
 }
 
-static int get_savegame_versions(FILE *fp, savegame_version_t *save_version, resource_version_t *resource_version)
-{
-    buffer buf;
-    uint8_t data[4];
-    buffer_init(&buf, data, 4);
-    if (fseek(fp, 4, SEEK_CUR) ||
-        fread(data, 1, 4, fp) != 4) {
-        return 0;
-    }
-    *save_version = buffer_read_i32(&buf);
-    int seek_back_bytes = -8;
-    if (*save_version > SAVE_GAME_LAST_STATIC_RESOURCES) {
-        buffer_reset(&buf);
-        if (fread(data, 1, 4, fp) != 4) {
-            return 0;
-        }
-        *resource_version = buffer_read_i32(&buf);
-        seek_back_bytes = -12;
-    } else {
-        *resource_version = RESOURCE_ORIGINAL_VERSION;
-    }
-    if (fseek(fp, seek_back_bytes, SEEK_CUR)) {
-        return 0;
-    }
-    return 1;
-}
-
 int game_file_io_read_save_game_from_buffer(buffer *buf)
 {
     int result = 0;
@@ -1529,36 +1492,15 @@ int game_file_io_read_save_game_from_buffer(buffer *buf)
 int game_file_io_read_saved_game(const char *filename, int offset)
 {
     log_info("Loading saved game", filename, 0);
-    FILE *fp = file_open(filename, "rb");
-    if (!fp) {
+    memory_block file_data;
+    buffer buf;
+    if (!read_file_to_buffer(filename, offset, &file_data, &buf)) {
         log_error("Unable to load game, unable to open file.", 0, 0);
         return FILE_LOAD_DOES_NOT_EXIST;
     }
-    if (offset) {
-        fseek(fp, offset, SEEK_SET);
-    }
-    int result = 0;
-    savegame_version_t save_version;
-    resource_version_t resource_version;
-    if (get_savegame_versions(fp, &save_version, &resource_version)) {
-        if (save_version > SAVE_GAME_CURRENT_VERSION || resource_version > RESOURCE_CURRENT_VERSION) {
-            log_error("Newer save game version than supported. Please update Augustus. Version:", 0, save_version);
-            file_close(fp);
-            return FILE_LOAD_INCOMPATIBLE_VERSION;
-        }
-        log_info("Savegame version", 0, save_version);
-        resource_set_mapping(resource_version);
-        init_savegame_data(save_version);
-        result = savegame_read_from_file(fp, save_version);
-    }
-    file_close(fp);
-    if (!result) {
-        log_error("Unable to load game, incompatible savefile.", 0, 0);
-        return FILE_LOAD_WRONG_FILE_FORMAT;
-    }
-    savegame_load_from_state(&savegame_data.state, save_version);
-    clear_savegame_pieces();
-    return 1;
+    int result = game_file_io_read_save_game_from_buffer(&buf);
+    core_memory_block_free(&file_data);
+    return result;
 }
 
 static int savegame_terrain_at(int grid_offset)
@@ -1696,32 +1638,30 @@ int game_file_io_read_saved_game_info(const char *filename, int offset, saved_ga
         return SAVEGAME_STATUS_INVALID;
     }
     memset(info, 0, sizeof(saved_game_info));
-    FILE *fp = file_open(filename, "rb");
-    if (!fp) {
+    memory_block file_data;
+    buffer buf;
+    if (!read_file_to_buffer(filename, offset, &file_data, &buf)) {
         return SAVEGAME_STATUS_INVALID;
     }
-    if (offset) {
-        fseek(fp, offset, SEEK_SET);
-    }
-    savegame_load_status result = SAVEGAME_STATUS_INVALID;
+    int result;
     savegame_version_t save_version;
     resource_version_t resource_version;
-    if (!get_savegame_versions(fp, &save_version, &resource_version)) {
-        file_close(fp);
-        return SAVEGAME_STATUS_INVALID;
-    }
-    if (save_version > SAVE_GAME_CURRENT_VERSION || resource_version > RESOURCE_CURRENT_VERSION) {
-        file_close(fp);
-        return SAVEGAME_STATUS_NEWER_VERSION;
-    }
-    resource_set_mapping(resource_version);
-    init_savegame_data(save_version);
-    result = savegame_read_from_file(fp, save_version);
-    file_close(fp);
-    if (result != SAVEGAME_STATUS_OK) {
-        return FILE_LOAD_WRONG_FILE_FORMAT;
+    if (!get_savegame_versions_from_buffer(&buf, &save_version, &resource_version)) {
+        result = SAVEGAME_STATUS_INVALID;
+    } else if (save_version > SAVE_GAME_CURRENT_VERSION || resource_version > RESOURCE_CURRENT_VERSION) {
+        result = SAVEGAME_STATUS_NEWER_VERSION;
+    } else {
+        resource_set_mapping(resource_version);
+        init_savegame_data(save_version);
+        if (savegame_read_from_buffer(&buf, save_version)) {
+            result = savegame_read_file_info(info, save_version);
+        } else {
+            clear_savegame_pieces();
+            result = FILE_LOAD_WRONG_FILE_FORMAT;
+        }
     }
-    return savegame_read_file_info(info, save_version);
+    core_memory_block_free(&file_data);
+    return result;
 }
 
 int game_file_io_read_saved_game_info_from_buffer(buffer *buf, saved_game_info *info)
@@ -1751,12 +1691,108 @@ int game_file_io_read_saved_game_info_from_buffer(buffer *buf, saved_game_info *
     return savegame_read_file_info(info, save_version);
 }
 
+static file_info_cache_entry *get_cached_file_info(const char *filename, unsigned int modified_time)
+{
+    for (int i = 0; i < FILE_INFO_CACHE_SIZE; i++) {
+        file_info_cache_entry *entry = &file_info_cache.entries[i];
+        if (entry->last_used && entry->modified_time == modified_time && strcmp(entry->filename, filename) == 0) {
+            return entry;
+        }
+    }
+    return 0;
+}
+
+static file_info_cache_entry *get_least_recently_used_cache_entry(void)
+{
+    file_info_cache_entry *result = &file_info_cache.entries[0];
+    for (int i = 1; i < FILE_INFO_CACHE_SIZE; i++) {
+        if (file_info_cache.entries[i].last_used < result->last_used) {
+            result = &file_info_cache.entries[i];
+        }
+    }
+    return result;
+}
+
+static void cache_file_info(const char *filename, unsigned int modified_time, int status, const saved_game_info *info)
+{
+    if (strlen(filename) >= FILE_NAME_MAX) {
+        return;
+    }
+    file_info_cache_entry *entry = get_least_recently_used_cache_entry();
+    clear_file_info_cache_entry(entry);
+    if (status == SAVEGAME_STATUS_OK) {
+        entry->minimap = widget_minimap_copy_pixels();
+        if (!entry->minimap) {
+            return;
+        }
+        entry->minimap_functions = minimap_data.functions;
+        entry->minimap_version = minimap_data.version;
+        entry->city_width = minimap_data.city_width;
+        entry->city_height = minimap_data.city_height;
+        entry->climate = minimap_data.climate;
+    }
+    strcpy(entry->filename, filename);
+    entry->modified_time = modified_time;
+    entry->status = status;
+    entry->info = *info;
+    entry->last_used = ++file_info_cache.use_count;
+}
+
+static int restore_cached_file_info(file_info_cache_entry *entry, saved_game_info *info)
+{
+    *info = entry->info;
+    if (entry->status == SAVEGAME_STATUS_OK) {
+        minimap_data.functions = entry->minimap_functions;
+        minimap_data.version = entry->minimap_version;
+        minimap_data.city_width = entry->city_width;
+        minimap_data.city_height = entry->city_height;
+        minimap_data.climate = entry->climate;
+        widget_minimap_restore_pixels(&minimap_data.functions, entry->minimap);
+    }
+    entry->last_used = ++file_info_cache.use_count;
+    return entry->status;
+}
+
+static int read_file_info_cached(const char *filename, unsigned int modified_time, saved_game_info *info,
+    int is_scenario)
+{
+    if (!info) {
+        return SAVEGAME_STATUS_INVALID;
+    }
+    // Without a modification time there is no way to tell whether the file changed since it was cached
+    if (modified_time) {
+        file_info_cache_entry *entry = get_cached_file_info(filename, modified_time);
+        if (entry) {
+            return restore_cached_file_info(entry, info);
+        }
+    }
+    int status = is_scenario ? game_file_io_read_scenario_info(filename, info) :
+        game_file_io_read_saved_game_info(filename, 0, info);
+    if (modified_time) {
+        cache_file_info(filename, modified_time, status, info);
+    }
+    return status;
+}
+
+int game_file_io_read_saved_game_info_cached(const char *filename, unsigned int modified_time,
+    saved_game_info *info)
+{
+    return read_file_info_cached(filename, modified_time, info, 0);
+}
+
+int game_file_io_read_scenario_info_cached(const char *filename, unsigned int modified_time,
+    saved_game_info *info)
+{
+    return read_file_info_cached(filename, modified_time, info, 1);
+}
+
 int game_file_io_write_saved_game(const char *filename)
 {
     resource_set_mapping(RESOURCE_CURRENT_VERSION);
     init_savegame_data(SAVE_GAME_CURRENT_VERSION);
 
     log_info("Saving game", filename, 0);
+    forget_cached_file_info(filename);
     savegame_save_to_state(&savegame_data.state);
 
     FILE *fp = file_open(filename, "wb");
@@ -1776,6 +1812,7 @@ int game_file_io_write_saved_game(const char *filename)
 int game_file_io_delete_saved_game(const char *filename)
 {
     log_info("Deleting game", filename, 0);
+    forget_cached_file_info(filename);
     int result = file_remove(filename);
     if (!result) {
         log_error("Unable to delete game", 0, 0);
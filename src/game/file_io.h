@@ -41,6 +41,9 @@ int game_file_io_read_scenario_info(const char *filename, saved_game_info *info)
 
 int game_file_io_read_scenario_info_from_buffer(buffer *buf, saved_game_info *info);
 
+int game_file_io_read_scenario_info_cached(const char *filename, unsigned int modified_time,
+    saved_game_info *info);
+
 int game_file_io_write_scenario(const char *filename);
 
 int game_file_io_read_saved_game(const char *filename, int offset);
@@ -51,6 +54,9 @@ int game_file_io_read_saved_game_info(const char *filename, int offset, saved_ga
 
 int game_file_io_read_saved_game_info_from_buffer(buffer *buf, saved_game_info *info);
 
+int game_file_io_read_saved_game_info_cached(const char *filename, unsigned int modified_time,
+    saved_game_info *info);
+
 int game_file_io_write_saved_game(const char *filename);
 
 int game_file_io_delete_saved_game(const char *filename);
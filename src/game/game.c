@@ -4,6 +4,7 @@
 #include "building/model.h"
 #include "building/properties.h"
 #include "city/view.h"
+#include "core/arena.h"
 #include "core/config.h"
 #include "core/hotkey_config.h"
 #include "core/image.h"
@@ -203,6 +204,7 @@ int game_reload_language(void)
 
 void game_run(void)
 {
+    arena_begin(ARENA_LIFETIME_FRAME);
     game_animation_update();
     int num_ticks = game_speed_get_elapsed_ticks();
     for (int i = 0; i < num_ticks; i++) {
@@ -0,0 +1,712 @@
+#include "replay.h"
+
+#include "building/barracks.h"
+#include "building/building.h"
+#include "building/construction.h"
+#include "building/data_transfer.h"
+#include "building/distribution.h"
+#include "building/dock.h"
+#include "building/industry.h"
+#include "building/menu.h"
+#include "building/monument.h"
+#include "building/roadblock.h"
+#include "building/rotation.h"
+#include "building/storage.h"
+#include "city/emperor.h"
+#include "city/festival.h"
+#include "city/finance.h"
+#include "city/games.h"
+#include "city/labor.h"
+#include "city/military.h"
+#include "city/population.h"
+#include "city/race_bet.h"
+#include "city/ratings.h"
+#include "city/resource.h"
+#include "city/trade_policy.h"
+#include "city/victory.h"
+#include "core/arena.h"
+#include "core/buffer.h"
+#include "core/config.h"
+#include "core/dir.h"
+#include "core/file.h"
+#include "core/log.h"
+#include "core/random.h"
+#include "empire/city.h"
+#include "figure/figure.h"
+#include "figure/formation.h"
+#include "figure/formation_legion.h"
+#include "figuretype/animal.h"
+#include "figuretype/depot.h"
+#include "game/file.h"
+#include "game/orientation.h"
+#include "game/settings.h"
+#include "game/state_hash.h"
+#include "game/tick.h"
+#include "game/undo.h"
+#include "map/grid.h"
+#include "map/point.h"
+#include "platform/file_manager.h"
+#include "scenario/request.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define REPLAY_MAGIC "AUGRPLAY"
+#define REPLAY_MAGIC_SIZE 8
+#define REPLAY_VERSION 4
+#define REPLAY_HEADER_SIZE (REPLAY_MAGIC_SIZE + 4)
+#define REPLAY_SETTINGS_SIZE (4 + 4 * CONFIG_MAX_ENTRIES + 4 + 4)
+
+#define MAX_ARGUMENTS 8
+#define ENTRY_SIZE (4 + 1 + 4 * MAX_ARGUMENTS + 8 + 8)
+
+#define CHECKPOINT_TICKS 50
+
+typedef struct {
+    uint32_t tick;
+    replay_command command;
+    int arguments[MAX_ARGUMENTS];
+    uint32_t random_iv1;
+    uint32_t random_iv2;
+    uint64_t state_hash;
+} replay_entry;
+
+typedef struct {
+    int config[CONFIG_MAX_ENTRIES];
+    int difficulty;
+    int gods_enabled;
+} replay_settings;
+
+static struct {
+    FILE *journal;
+    uint32_t tick;
+    replay_settings settings;
+    int settings_copied;
+} data;
+
+static void get_replay_path(char *path, const char *name, const char *extension)
+{
+    snprintf(path, FILE_NAME_MAX, "%s%s.%s",
+        platform_file_manager_get_directory_for_location(PATH_LOCATION_SAVEGAME, 0), name, extension);
+}
+
+static void get_current_settings(replay_settings *settings)
+{
+    for (int i = 0; i < CONFIG_MAX_ENTRIES; i++) {
+        settings->config[i] = config_get(i);
+    }
+    settings->difficulty = setting_difficulty();
+    settings->gods_enabled = setting_gods_enabled();
+}
+
+static void change_difficulty(int difficulty)
+{
+    while (setting_difficulty() < difficulty && setting_difficulty() < DIFFICULTY_VERY_HARD) {
+        setting_increase_difficulty();
+    }
+    while (setting_difficulty() > difficulty && setting_difficulty() > DIFFICULTY_VERY_EASY) {
+        setting_decrease_difficulty();
+    }
+}
+
+static void change_gods_enabled(int enabled)
+{
+    if (setting_gods_enabled() != enabled) {
+        setting_toggle_gods_enabled();
+    }
+}
+
+static void apply_settings(const replay_settings *settings)
+{
+    for (int i = 0; i < CONFIG_MAX_ENTRIES; i++) {
+        config_set(i, settings->config[i]);
+    }
+    change_difficulty(settings->difficulty);
+    change_gods_enabled(settings->gods_enabled);
+}
+
+static int write_header(FILE *fp, const replay_settings *settings)
+{
+    uint8_t header[REPLAY_HEADER_SIZE + REPLAY_SETTINGS_SIZE];
+    buffer buf;
+    buffer_init(&buf, header, REPLAY_HEADER_SIZE + REPLAY_SETTINGS_SIZE);
+    buffer_write_raw(&buf, REPLAY_MAGIC, REPLAY_MAGIC_SIZE);
+    buffer_write_u32(&buf, REPLAY_VERSION);
+    buffer_write_u32(&buf, CONFIG_MAX_ENTRIES);
+    for (int i = 0; i < CONFIG_MAX_ENTRIES; i++) {
+        buffer_write_i32(&buf, settings->config[i]);
+    }
+    buffer_write_i32(&buf, settings->difficulty);
+    buffer_write_i32(&buf, settings->gods_enabled);
+    return fwrite(header, 1, buf.index, fp) == buf.index;
+}
+
+static int read_i32(FILE *fp, int *value)
+{
+    uint8_t raw[4];
+    if (fread(raw, 1, 4, fp) != 4) {
+        return 0;
+    }
+    buffer buf;
+    buffer_init(&buf, raw, 4);
+    *value = buffer_read_i32(&buf);
+    return 1;
+}
+
+static int read_header(FILE *fp, replay_settings *settings)
+{
+    uint8_t header[REPLAY_HEADER_SIZE];
+    if (fread(header, 1, REPLAY_HEADER_SIZE, fp) != REPLAY_HEADER_SIZE) {
+        return 0;
+    }
+    if (memcmp(header, REPLAY_MAGIC, REPLAY_MAGIC_SIZE) != 0) {
+        return 0;
+    }
+    buffer buf;
+    buffer_init(&buf, header, REPLAY_HEADER_SIZE);
+    buffer_skip(&buf, REPLAY_MAGIC_SIZE);
+    if (buffer_read_u32(&buf) != REPLAY_VERSION) {
+        return 0;
+    }
+    // Config options that did not exist when the replay was recorded keep their current value
+    get_current_settings(settings);
+    int num_config;
+    if (!read_i32(fp, &num_config) || num_config < 0) {
+        return 0;
+    }
+    for (int i = 0; i < num_config; i++) {
+        int value;
+        if (!read_i32(fp, &value)) {
+            return 0;
+        }
+        if (i < CONFIG_MAX_ENTRIES) {
+            settings->config[i] = value;
+        }
+    }
+    return read_i32(fp, &settings->difficulty) && read_i32(fp, &settings->gods_enabled);
+}
+
+static void write_entry(replay_command command, const int *arguments)
+{
+    uint8_t entry[ENTRY_SIZE];
+    buffer buf;
+    buffer_init(&buf, entry, ENTRY_SIZE);
+    buffer_write_u32(&buf, data.tick);
+    buffer_write_u8(&buf, (uint8_t) command);
+    for (int i = 0; i < MAX_ARGUMENTS; i++) {
+        buffer_write_i32(&buf, arguments[i]);
+    }
+    uint32_t iv1, iv2;
+    random_get_state(&iv1, &iv2);
+    buffer_write_u32(&buf, iv1);
+    buffer_write_u32(&buf, iv2);
+    state_hash hash;
+    game_state_hash_calculate(&hash);
+    buffer_write_u32(&buf, (uint32_t) hash.total);
+    buffer_write_u32(&buf, (uint32_t) (hash.total >> 32));
+    if (fwrite(entry, 1, ENTRY_SIZE, data.journal) != ENTRY_SIZE) {
+        log_error("Unable to write replay entry, stopping recording", 0, command);
+        file_close(data.journal);
+        data.journal = 0;
+    }
+}
+
+static int read_entry(FILE *fp, replay_entry *entry)
+{
+    uint8_t raw[ENTRY_SIZE];
+    if (fread(raw, 1, ENTRY_SIZE, fp) != ENTRY_SIZE) {
+        return 0;
+    }
+    buffer buf;
+    buffer_init(&buf, raw, ENTRY_SIZE);
+    entry->tick = buffer_read_u32(&buf);
+    entry->command = buffer_read_u8(&buf);
+    for (int i = 0; i < MAX_ARGUMENTS; i++) {
+        entry->arguments[i] = buffer_read_i32(&buf);
+    }
+    entry->random_iv1 = buffer_read_u32(&buf);
+    entry->random_iv2 = buffer_read_u32(&buf);
+    entry->state_hash = buffer_read_u32(&buf);
+    entry->state_hash |= (uint64_t) buffer_read_u32(&buf) << 32;
+    return entry->command < REPLAY_COMMAND_MAX;
+}
+
+int game_replay_start_recording(const char *name)
+{
+    game_replay_stop_recording();
+
+    char path[FILE_NAME_MAX];
+    get_replay_path(path, name, "svx");
+    if (!game_file_write_saved_game(path)) {
+        log_error("Unable to save replay starting point", path, 0);
+        return 0;
+    }
+    get_replay_path(path, name, "rpl");
+    FILE *fp = file_open(path, "wb");
+    if (!fp) {
+        log_error("Unable to create replay journal", path, 0);
+        return 0;
+    }
+    get_current_settings(&data.settings);
+    if (!write_header(fp, &data.settings)) {
+        log_error("Unable to write replay journal", path, 0);
+        file_close(fp);
+        return 0;
+    }
+    // Neither the undo state nor the copied building settings are saved, so they cannot be replayed
+    game_undo_disable();
+    data.journal = fp;
+    data.tick = 0;
+    data.settings_copied = 0;
+    log_info("Started recording replay", name, 0);
+    return 1;
+}
+
+void game_replay_stop_recording(void)
+{
+    if (!data.journal) {
+        return;
+    }
+    int arguments[MAX_ARGUMENTS] = { 0 };
+    write_entry(REPLAY_COMMAND_END, arguments);
+    if (data.journal) {
+        file_close(data.journal);
+        data.journal = 0;
+    }
+    log_info("Stopped recording replay at tick", 0, data.tick);
+}
+
+static void record_settings_changes(void)
+{
+    replay_settings current;
+    get_current_settings(&current);
+    int arguments[MAX_ARGUMENTS] = { 0 };
+    for (int i = 0; i < CONFIG_MAX_ENTRIES && data.journal; i++) {
+        if (current.config[i] != data.settings.config[i]) {
+            arguments[0] = i;
+            arguments[1] = current.config[i];
+            write_entry(REPLAY_COMMAND_SET_CONFIG, arguments);
+        }
+    }
+    if (current.difficulty != data.settings.difficulty && data.journal) {
+        arguments[0] = current.difficulty;
+        arguments[1] = 0;
+        write_entry(REPLAY_COMMAND_SET_DIFFICULTY, arguments);
+    }
+    if (current.gods_enabled != data.settings.gods_enabled && data.journal) {
+        arguments[0] = current.gods_enabled;
+        arguments[1] = 0;
+        write_entry(REPLAY_COMMAND_SET_GODS_ENABLED, arguments);
+    }
+    data.settings = current;
+}
+
+void game_replay_record_tick(void)
+{
+    if (!data.journal) {
+        return;
+    }
+    // Settings can be changed between ticks, so the changes are journaled before the next tick runs
+    record_settings_changes();
+    if (!data.journal) {
+        return;
+    }
+    if (data.tick && data.tick % CHECKPOINT_TICKS == 0) {
+        int arguments[MAX_ARGUMENTS] = { 0 };
+        write_entry(REPLAY_COMMAND_CHECKPOINT, arguments);
+    }
+    data.tick++;
+}
+
+void game_replay_record_command(replay_command command, int value1, int value2, int value3)
+{
+    if (!data.journal) {
+        return;
+    }
+    int arguments[MAX_ARGUMENTS] = { value1, value2, value3 };
+    write_entry(command, arguments);
+}
+
+void game_replay_record_depot_order(int building_id, const order *new_order)
+{
+    if (!data.journal) {
+        return;
+    }
+    int arguments[MAX_ARGUMENTS] = {
+        building_id, new_order->resource_type, new_order->src_storage_id, new_order->dst_storage_id,
+        new_order->condition.condition_type, new_order->condition.threshold
+    };
+    write_entry(REPLAY_COMMAND_SET_DEPOT_ORDER, arguments);
+}
+
+void game_replay_record_copy_settings(int building_id)
+{
+    if (!data.journal) {
+        return;
+    }
+    int arguments[MAX_ARGUMENTS] = { building_id };
+    write_entry(REPLAY_COMMAND_COPY_SETTINGS, arguments);
+    data.settings_copied = 1;
+}
+
+void game_replay_record_paste_settings(int building_id)
+{
+    if (!data.journal) {
+        return;
+    }
+    if (!data.settings_copied) {
+        game_replay_record_unjournaled("paste building settings copied before recording");
+        return;
+    }
+    int arguments[MAX_ARGUMENTS] = { building_id };
+    write_entry(REPLAY_COMMAND_PASTE_SETTINGS, arguments);
+}
+
+void game_replay_record_construction(int type, int x_start, int y_start, int x_end, int y_end)
+{
+    if (!data.journal) {
+        return;
+    }
+    int arguments[MAX_ARGUMENTS] = { type, x_start, y_start, x_end, y_end };
+    building_rotation_get_state(&arguments[5], &arguments[6], &arguments[7]);
+    write_entry(REPLAY_COMMAND_CONSTRUCTION, arguments);
+}
+
+void game_replay_record_unjournaled(const char *command)
+{
+    if (!data.journal) {
+        return;
+    }
+    log_error("Player command cannot be replayed, stopping replay recording:", command, 0);
+    int arguments[MAX_ARGUMENTS] = { 0 };
+    write_entry(REPLAY_COMMAND_UNREPLAYABLE, arguments);
+    if (data.journal) {
+        file_close(data.journal);
+        data.journal = 0;
+    }
+}
+
+static void replay_construction(const int *arguments)
+{
+    int x_start = arguments[1];
+    int y_start = arguments[2];
+    int x_end = arguments[3];
+    int y_end = arguments[4];
+    building_construction_set_type(arguments[0], 0);
+    building_rotation_set_state(arguments[5], arguments[6], arguments[7]);
+    building_construction_start(x_start, y_start, map_grid_offset(x_start, y_start));
+    if (building_construction_in_progress()) {
+        building_construction_update(x_end, y_end, map_grid_offset(x_end, y_end));
+        building_construction_place();
+    }
+    building_construction_clear_type();
+}
+
+static void replay_depot_order(const int *arguments)
+{
+    order new_order;
+    new_order.resource_type = arguments[1];
+    new_order.src_storage_id = arguments[2];
+    new_order.dst_storage_id = arguments[3];
+    new_order.condition.condition_type = arguments[4];
+    new_order.condition.threshold = arguments[5];
+    building_depot_set_order(building_get(arguments[0]), &new_order);
+}
+
+static void replay_move_legion(const int *arguments)
+{
+    map_tile tile;
+    tile.x = arguments[1];
+    tile.y = arguments[2];
+    tile.grid_offset = map_grid_offset(tile.x, tile.y);
+    formation_legion_move_to(formation_get(arguments[0]), &tile);
+}
+
+static void replay_command_entry(const replay_entry *entry)
+{
+    const int *arguments = entry->arguments;
+    switch (entry->command) {
+        case REPLAY_COMMAND_CONSTRUCTION:
+            replay_construction(arguments);
+            break;
+        case REPLAY_COMMAND_ROTATE_VIEW:
+            if (arguments[0]) {
+                game_orientation_rotate_right();
+            } else {
+                game_orientation_rotate_left();
+            }
+            break;
+        case REPLAY_COMMAND_CHANGE_TAX:
+            city_finance_change_tax_percentage(arguments[0]);
+            break;
+        case REPLAY_COMMAND_CHANGE_WAGES:
+            city_labor_change_wages(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SET_LABOR_PRIORITY:
+            city_labor_set_priority(arguments[0], arguments[1]);
+            break;
+        case REPLAY_COMMAND_SET_CONFIG:
+            if (arguments[0] >= 0 && arguments[0] < CONFIG_MAX_ENTRIES) {
+                config_set(arguments[0], arguments[1]);
+            }
+            break;
+        case REPLAY_COMMAND_SET_DIFFICULTY:
+            change_difficulty(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SET_GODS_ENABLED:
+            change_gods_enabled(arguments[0]);
+            break;
+        case REPLAY_COMMAND_UNDO:
+            game_undo_perform();
+            break;
+        case REPLAY_COMMAND_TOGGLE_GOOD_ACCEPTED:
+            building_distribution_toggle_good_accepted(building_get(arguments[0]), arguments[1]);
+            break;
+        case REPLAY_COMMAND_ACCEPT_ALL_GOODS:
+            if (arguments[1]) {
+                building_distribution_accept_all_goods(building_get(arguments[0]));
+            } else {
+                building_distribution_unaccept_all_goods(building_get(arguments[0]));
+            }
+            break;
+        case REPLAY_COMMAND_CYCLE_STORAGE_STATE:
+            building_storage_cycle_resource_state(arguments[0], arguments[1], arguments[2]);
+            break;
+        case REPLAY_COMMAND_CYCLE_PARTIAL_STORAGE_STATE:
+            building_storage_cycle_partial_resource_state(arguments[0], arguments[1], arguments[2]);
+            break;
+        case REPLAY_COMMAND_TOGGLE_STORAGE_EMPTY_ALL:
+            building_storage_toggle_empty_all(arguments[0]);
+            break;
+        case REPLAY_COMMAND_STORAGE_ACCEPT_ALL:
+            if (arguments[1]) {
+                building_storage_accept_all(arguments[0]);
+            } else {
+                building_storage_accept_none(arguments[0]);
+            }
+            break;
+        case REPLAY_COMMAND_TOGGLE_STORAGE_PERMISSION:
+            building_storage_toggle_permission(arguments[0], building_get(arguments[1]));
+            break;
+        case REPLAY_COMMAND_SET_STORAGE_PERMISSION:
+            building_storage_set_permission(arguments[0], building_get(arguments[1]), arguments[2]);
+            break;
+        case REPLAY_COMMAND_TOGGLE_ROADBLOCK_PERMISSION:
+            building_roadblock_set_permission(arguments[0], building_get(arguments[1]));
+            break;
+        case REPLAY_COMMAND_ROADBLOCK_ACCEPT_ALL:
+            if (arguments[1]) {
+                building_roadblock_accept_all(building_get(arguments[0]));
+            } else {
+                building_roadblock_accept_none(building_get(arguments[0]));
+            }
+            break;
+        case REPLAY_COMMAND_SET_DOCK_TRADE_ROUTE:
+            building_dock_set_can_trade_with_route(arguments[0], arguments[1], arguments[2]);
+            break;
+        case REPLAY_COMMAND_TOGGLE_MOTHBALL:
+            building_mothball_toggle(building_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_TOGGLE_STOCKPILING:
+            building_stockpiling_toggle(building_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_SET_BARRACKS_PRIORITY:
+            building_barracks_set_priority(building_get(arguments[0]), arguments[1]);
+            break;
+        case REPLAY_COMMAND_TOGGLE_BARRACKS_DELIVERY:
+            building_barracks_toggle_delivery(building_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_ADD_MONUMENT_MODULE:
+            building_monument_add_module(building_get(arguments[0]), arguments[1]);
+            break;
+        case REPLAY_COMMAND_TOGGLE_MONUMENT_HALTED:
+            building_monument_toggle_construction_halted(building_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_REPAIR_BUILDING:
+            building_repair(building_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_SWITCH_MINT_OUTPUT:
+            building_industry_switch_mint_output(building_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_SET_DEPOT_ORDER:
+            replay_depot_order(arguments);
+            break;
+        case REPLAY_COMMAND_RECALL_DEPOT_CART:
+            figure_depot_recall(figure_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_COPY_SETTINGS:
+            building_data_transfer_copy(building_get(arguments[0]), 1);
+            break;
+        case REPLAY_COMMAND_PASTE_SETTINGS:
+            building_data_transfer_paste(building_get(arguments[0]), 1);
+            break;
+        case REPLAY_COMMAND_NUDGE_ANIMAL:
+            figure_animal_try_nudge_at(arguments[0], arguments[1], arguments[2]);
+            break;
+        case REPLAY_COMMAND_CHANGE_LEGION_LAYOUT:
+            formation_legion_change_layout(formation_get(arguments[0]), arguments[1]);
+            break;
+        case REPLAY_COMMAND_MOVE_LEGION:
+            replay_move_legion(arguments);
+            break;
+        case REPLAY_COMMAND_RETURN_LEGION_HOME:
+            formation_legion_return_home(formation_get(arguments[0]));
+            break;
+        case REPLAY_COMMAND_TOGGLE_EMPIRE_SERVICE:
+            formation_toggle_empire_service(arguments[0]);
+            break;
+        case REPLAY_COMMAND_CLEAR_EMPIRE_SERVICE:
+            city_military_clear_empire_service_legions();
+            break;
+        case REPLAY_COMMAND_DISPATCH_TO_DISTANT_BATTLE:
+            formation_legions_dispatch_to_distant_battle();
+            break;
+        case REPLAY_COMMAND_CYCLE_TRADE_STATUS:
+            city_resource_cycle_trade_status(arguments[0], arguments[1]);
+            break;
+        case REPLAY_COMMAND_CHANGE_IMPORT_OVER:
+            city_resource_change_import_over(arguments[0], arguments[1]);
+            break;
+        case REPLAY_COMMAND_CHANGE_EXPORT_OVER:
+            city_resource_change_export_over(arguments[0], arguments[1]);
+            break;
+        case REPLAY_COMMAND_TOGGLE_STOCKPILED:
+            city_resource_toggle_stockpiled(arguments[0]);
+            break;
+        case REPLAY_COMMAND_TOGGLE_MOTHBALLED:
+            city_resource_toggle_mothballed(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SET_TRADE_POLICY:
+            city_trade_policy_set(arguments[0], arguments[1]);
+            break;
+        case REPLAY_COMMAND_OPEN_TRADE_ROUTE:
+            empire_city_open_trade(arguments[0], 1);
+            building_menu_update();
+            break;
+        case REPLAY_COMMAND_SET_SALARY:
+            city_emperor_set_salary_rank(arguments[0]);
+            city_finance_update_salary();
+            city_ratings_update_favor_explanation();
+            break;
+        case REPLAY_COMMAND_SELECT_FESTIVAL_GOD:
+            city_festival_select_god(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SELECT_FESTIVAL_SIZE:
+            city_festival_select_size(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SCHEDULE_FESTIVAL:
+            city_festival_schedule();
+            break;
+        case REPLAY_COMMAND_SCHEDULE_GAMES:
+            city_games_schedule(arguments[0]);
+            break;
+        case REPLAY_COMMAND_PLACE_RACE_BET:
+            city_race_bet_place(arguments[0], arguments[1]);
+            break;
+        case REPLAY_COMMAND_INIT_SELECTED_GIFT:
+            city_emperor_init_selected_gift();
+            break;
+        case REPLAY_COMMAND_SET_GIFT_SIZE:
+            city_emperor_set_gift_size(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SEND_GIFT:
+            city_emperor_send_gift();
+            break;
+        case REPLAY_COMMAND_SET_DONATION_AMOUNT:
+            city_emperor_set_donation_amount(arguments[0]);
+            break;
+        case REPLAY_COMMAND_DONATE:
+            city_emperor_donate_savings_to_city();
+            break;
+        case REPLAY_COMMAND_DISPATCH_REQUEST:
+            scenario_request_dispatch(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SELECT_RATING:
+            city_rating_select(arguments[0]);
+            break;
+        case REPLAY_COMMAND_SET_GRAPH_ORDER:
+            city_population_set_graph_order(arguments[0]);
+            break;
+        case REPLAY_COMMAND_CONTINUE_GOVERNING:
+            city_victory_continue_governing(arguments[0]);
+            break;
+        case REPLAY_COMMAND_STOP_GOVERNING:
+            city_victory_stop_governing();
+            break;
+        default:
+            break;
+    }
+}
+
+int game_replay_play(const char *name)
+{
+    game_replay_stop_recording();
+
+    char path[FILE_NAME_MAX];
+    get_replay_path(path, name, "rpl");
+    FILE *fp = file_open(path, "rb");
+    if (!fp) {
+        log_error("Unable to open replay journal", path, 0);
+        return 0;
+    }
+    replay_settings recorded_settings;
+    if (!read_header(fp, &recorded_settings)) {
+        log_error("Invalid replay journal", path, 0);
+        file_close(fp);
+        return 0;
+    }
+    get_replay_path(path, name, "svx");
+    if (game_file_load_saved_game(path) != FILE_LOAD_SUCCESS) {
+        log_error("Unable to load replay starting point", path, 0);
+        file_close(fp);
+        return 0;
+    }
+    replay_settings previous_settings;
+    get_current_settings(&previous_settings);
+    apply_settings(&recorded_settings);
+
+    uint32_t tick = 0;
+    int diverged = 0;
+    int unreplayable = 0;
+    int finished = 0;
+    replay_entry entry;
+    while (!finished && read_entry(fp, &entry)) {
+        while (tick < entry.tick) {
+            game_tick_run();
+            tick++;
+        }
+        if (!diverged) {
+            uint32_t iv1, iv2;
+            random_get_state(&iv1, &iv2);
+            state_hash hash;
+            game_state_hash_calculate(&hash);
+            if (iv1 != entry.random_iv1 || iv2 != entry.random_iv2 || hash.total != entry.state_hash) {
+                log_error("Replay diverged from recording at tick", 0, tick);
+                game_state_hash_log(&hash);
+                diverged = 1;
+            }
+        }
+        if (entry.command == REPLAY_COMMAND_END) {
+            finished = 1;
+        } else if (entry.command == REPLAY_COMMAND_UNREPLAYABLE) {
+            log_error("Replay recording was stopped by a command that cannot be replayed, at tick", 0, tick);
+            unreplayable = 1;
+            finished = 1;
+        } else {
+            arena_begin(ARENA_LIFETIME_FRAME); // no frames are drawn, each command counts as one
+            replay_command_entry(&entry);
+        }
+    }
+    file_close(fp);
+    apply_settings(&previous_settings);
+
+    if (!finished) {
+        log_error("Replay journal ended unexpectedly at tick", 0, tick);
+        return 0;
+    }
+    if (diverged || unreplayable) {
+        return 0;
+    }
+    log_info("Replay matched recording, ticks played:", 0, tick);
+    return 1;
+}
@@ -0,0 +1,161 @@
+#ifndef GAME_REPLAY_H
+#define GAME_REPLAY_H
+
+/**
+ * @file
+ * Replay recording and playback.
+ *
+ * A replay consists of a saved game that is the starting point and a journal of the player commands
+ * with the tick they were given on. Playing a replay loads the saved game and runs the ticks as fast
+ * as possible, giving the commands at the same ticks. Every journal entry also holds the random state
+ * and the state hash, so a playback that does not end up with the same simulation results is detected.
+ * A checkpoint entry is written every game day so a divergence can be pinpointed.
+ *
+ * The settings that can affect the simulation are stored when recording starts and journaled when they change.
+ * Player commands that are not journaled, such as cheats, cannot be replayed. When one is given, the journal is
+ * marked as unreplayable and recording stops, so playing it back fails instead of silently giving different results.
+ */
+
+typedef enum {
+    REPLAY_COMMAND_END = 0,
+    REPLAY_COMMAND_CONSTRUCTION = 1,
+    REPLAY_COMMAND_ROTATE_VIEW = 2,
+    REPLAY_COMMAND_CHANGE_TAX = 3,
+    REPLAY_COMMAND_CHANGE_WAGES = 4,
+    REPLAY_COMMAND_SET_LABOR_PRIORITY = 5,
+    REPLAY_COMMAND_CHECKPOINT = 6,
+    REPLAY_COMMAND_UNREPLAYABLE = 7,
+    REPLAY_COMMAND_SET_CONFIG = 8,
+    REPLAY_COMMAND_SET_DIFFICULTY = 9,
+    REPLAY_COMMAND_SET_GODS_ENABLED = 10,
+    REPLAY_COMMAND_UNDO = 11,
+    REPLAY_COMMAND_TOGGLE_GOOD_ACCEPTED = 12,
+    REPLAY_COMMAND_ACCEPT_ALL_GOODS = 13,
+    REPLAY_COMMAND_CYCLE_STORAGE_STATE = 14,
+    REPLAY_COMMAND_CYCLE_PARTIAL_STORAGE_STATE = 15,
+    REPLAY_COMMAND_TOGGLE_STORAGE_EMPTY_ALL = 16,
+    REPLAY_COMMAND_STORAGE_ACCEPT_ALL = 17,
+    REPLAY_COMMAND_TOGGLE_STORAGE_PERMISSION = 18,
+    REPLAY_COMMAND_SET_STORAGE_PERMISSION = 19,
+    REPLAY_COMMAND_TOGGLE_ROADBLOCK_PERMISSION = 20,
+    REPLAY_COMMAND_ROADBLOCK_ACCEPT_ALL = 21,
+    REPLAY_COMMAND_SET_DOCK_TRADE_ROUTE = 22,
+    REPLAY_COMMAND_TOGGLE_MOTHBALL = 23,
+    REPLAY_COMMAND_TOGGLE_STOCKPILING = 24,
+    REPLAY_COMMAND_SET_BARRACKS_PRIORITY = 25,
+    REPLAY_COMMAND_TOGGLE_BARRACKS_DELIVERY = 26,
+    REPLAY_COMMAND_ADD_MONUMENT_MODULE = 27,
+    REPLAY_COMMAND_TOGGLE_MONUMENT_HALTED = 28,
+    REPLAY_COMMAND_REPAIR_BUILDING = 29,
+    REPLAY_COMMAND_SWITCH_MINT_OUTPUT = 30,
+    REPLAY_COMMAND_SET_DEPOT_ORDER = 31,
+    REPLAY_COMMAND_RECALL_DEPOT_CART = 32,
+    REPLAY_COMMAND_COPY_SETTINGS = 33,
+    REPLAY_COMMAND_PASTE_SETTINGS = 34,
+    REPLAY_COMMAND_NUDGE_ANIMAL = 35,
+    REPLAY_COMMAND_CHANGE_LEGION_LAYOUT = 36,
+    REPLAY_COMMAND_MOVE_LEGION = 37,
+    REPLAY_COMMAND_RETURN_LEGION_HOME = 38,
+    REPLAY_COMMAND_TOGGLE_EMPIRE_SERVICE = 39,
+    REPLAY_COMMAND_CLEAR_EMPIRE_SERVICE = 40,
+    REPLAY_COMMAND_DISPATCH_TO_DISTANT_BATTLE = 41,
+    REPLAY_COMMAND_CYCLE_TRADE_STATUS = 42,
+    REPLAY_COMMAND_CHANGE_IMPORT_OVER = 43,
+    REPLAY_COMMAND_CHANGE_EXPORT_OVER = 44,
+    REPLAY_COMMAND_TOGGLE_STOCKPILED = 45,
+    REPLAY_COMMAND_TOGGLE_MOTHBALLED = 46,
+    REPLAY_COMMAND_SET_TRADE_POLICY = 47,
+    REPLAY_COMMAND_OPEN_TRADE_ROUTE = 48,
+    REPLAY_COMMAND_SET_SALARY = 49,
+    REPLAY_COMMAND_SELECT_FESTIVAL_GOD = 50,
+    REPLAY_COMMAND_SELECT_FESTIVAL_SIZE = 51,
+    REPLAY_COMMAND_SCHEDULE_FESTIVAL = 52,
+    REPLAY_COMMAND_SCHEDULE_GAMES = 53,
+    REPLAY_COMMAND_PLACE_RACE_BET = 54,
+    REPLAY_COMMAND_INIT_SELECTED_GIFT = 55,
+    REPLAY_COMMAND_SET_GIFT_SIZE = 56,
+    REPLAY_COMMAND_SEND_GIFT = 57,
+    REPLAY_COMMAND_SET_DONATION_AMOUNT = 58,
+    REPLAY_COMMAND_DONATE = 59,
+    REPLAY_COMMAND_DISPATCH_REQUEST = 60,
+    REPLAY_COMMAND_SELECT_RATING = 61,
+    REPLAY_COMMAND_SET_GRAPH_ORDER = 62,
+    REPLAY_COMMAND_CONTINUE_GOVERNING = 63,
+    REPLAY_COMMAND_STOP_GOVERNING = 64,
+    REPLAY_COMMAND_MAX
+} replay_command;
+
+struct order;
+
+/**
+ * Starts recording a replay, stopping any recording in progress
+ * @param name Name of the replay, without extension
+ * @return 1 if recording started, 0 on error
+ */
+int game_replay_start_recording(const char *name);
+
+/**
+ * Stops recording the replay
+ */
+void game_replay_stop_recording(void);
+
+/**
+ * Counts a game tick for the replay being recorded
+ */
+void game_replay_record_tick(void);
+
+/**
+ * Records a player command for the replay being recorded.
+ * Must be called before the command changes the simulation.
+ * @param command Command type
+ * @param value1 First value of the command
+ * @param value2 Second value of the command
+ * @param value3 Third value of the command
+ */
+void game_replay_record_command(replay_command command, int value1, int value2, int value3);
+
+/**
+ * Records the placement of a building for the replay being recorded
+ * @param type Building type
+ * @param x_start X tile where construction was started
+ * @param y_start Y tile where construction was started
+ * @param x_end X tile where construction ended
+ * @param y_end Y tile where construction ended
+ */
+void game_replay_record_construction(int type, int x_start, int y_start, int x_end, int y_end);
+
+/**
+ * Records a new order for a cart depot for the replay being recorded
+ * @param building_id Id of the depot
+ * @param new_order The order the depot will have
+ */
+void game_replay_record_depot_order(int building_id, const struct order *new_order);
+
+/**
+ * Records copying the settings of a building for the replay being recorded
+ * @param building_id Id of the building the settings are copied from
+ */
+void game_replay_record_copy_settings(int building_id);
+
+/**
+ * Records pasting the copied building settings for the replay being recorded.
+ * If the settings were not copied while recording, the paste cannot be replayed and recording stops.
+ * @param building_id Id of the building the settings are pasted on
+ */
+void game_replay_record_paste_settings(int building_id);
+
+/**
+ * Marks the replay being recorded as unreplayable and stops recording.
+ * Must be called before any player command that changes the simulation and is not journaled.
+ * @param command Description of the command, for the log
+ */
+void game_replay_record_unjournaled(const char *command);
+
+/**
+ * Plays a replay
+ * @param name Name of the replay, without extension
+ * @return 1 if the replay played back with the same results as when it was recorded, 0 otherwise
+ */
+int game_replay_play(const char *name);
+
+#endif // GAME_REPLAY_H
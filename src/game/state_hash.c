@@ -0,0 +1,163 @@
+#include "state_hash.h"
+
+#include "building/building.h"
+#include "city/data.h"
+#include "core/buffer.h"
+#include "core/hash.h"
+#include "core/log.h"
+#include "figure/figure.h"
+#include "map/desirability.h"
+#include "map/grid.h"
+#include "map/road_network.h"
+#include "map/routing_data.h"
+#include "map/terrain.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCRATCH_SIZE (GRID_SIZE * GRID_SIZE * sizeof(uint32_t))
+
+static const char *SECTION_NAMES[STATE_HASH_MAX] = {
+    "buildings", "figures", "terrain", "desirability", "routing", "road network", "city"
+};
+
+static uint8_t *scratch;
+
+static void add_buffer(hash_state *state, const buffer *buf)
+{
+    hash_update(state, buf->data, buf->index);
+}
+
+static void hash_buildings(hash_state *state)
+{
+    uint8_t highest_id_data[4];
+    uint8_t highest_id_ever_data[8];
+    uint8_t sequence_data[4];
+    uint8_t corrupt_houses_data[8];
+    buffer list, highest_id, highest_id_ever, sequence, corrupt_houses;
+    buffer_init(&highest_id, highest_id_data, sizeof(highest_id_data));
+    buffer_init(&highest_id_ever, highest_id_ever_data, sizeof(highest_id_ever_data));
+    buffer_init(&sequence, sequence_data, sizeof(sequence_data));
+    buffer_init(&corrupt_houses, corrupt_houses_data, sizeof(corrupt_houses_data));
+
+    building_save_state(&list, &highest_id, &highest_id_ever, &sequence, &corrupt_houses);
+    if (list.data) {
+        add_buffer(state, &list);
+        free(list.data);
+    }
+    add_buffer(state, &highest_id);
+    add_buffer(state, &sequence);
+    add_buffer(state, &corrupt_houses);
+}
+
+static void hash_figures(hash_state *state)
+{
+    uint8_t sequence_data[4];
+    buffer list, sequence;
+    buffer_init(&sequence, sequence_data, sizeof(sequence_data));
+
+    figure_save_state(&list, &sequence);
+    if (list.data) {
+        add_buffer(state, &list);
+        free(list.data);
+    }
+    add_buffer(state, &sequence);
+}
+
+static void hash_grid(hash_state *state, void (*save_state)(buffer *buf))
+{
+    buffer buf;
+    buffer_init(&buf, scratch, SCRATCH_SIZE);
+    save_state(&buf);
+    add_buffer(state, &buf);
+}
+
+static void hash_routing(hash_state *state)
+{
+    hash_update(state, terrain_land_citizen.items, sizeof(terrain_land_citizen.items));
+    hash_update(state, terrain_land_noncitizen.items, sizeof(terrain_land_noncitizen.items));
+    hash_update(state, terrain_water.items, sizeof(terrain_water.items));
+    hash_update(state, terrain_walls.items, sizeof(terrain_walls.items));
+}
+
+static void hash_city(hash_state *state)
+{
+    uint8_t graph_order_data[8];
+    uint8_t entry_exit_xy_data[16];
+    uint8_t entry_exit_grid_offset_data[8];
+    buffer main, graph_order, entry_exit_xy, entry_exit_grid_offset;
+    buffer_init(&main, scratch, SCRATCH_SIZE);
+    buffer_init(&graph_order, graph_order_data, sizeof(graph_order_data));
+    buffer_init(&entry_exit_xy, entry_exit_xy_data, sizeof(entry_exit_xy_data));
+    buffer_init(&entry_exit_grid_offset, entry_exit_grid_offset_data, sizeof(entry_exit_grid_offset_data));
+
+    city_data_save_state(&main, &graph_order, &entry_exit_xy, &entry_exit_grid_offset);
+    add_buffer(state, &main);
+    add_buffer(state, &graph_order);
+    add_buffer(state, &entry_exit_xy);
+    add_buffer(state, &entry_exit_grid_offset);
+}
+
+void game_state_hash_calculate(state_hash *hash)
+{
+    if (!scratch) {
+        scratch = malloc(SCRATCH_SIZE);
+        if (!scratch) {
+            log_error("Unable to allocate memory for the state hash", 0, 0);
+            memset(hash, 0, sizeof(state_hash));
+            return;
+        }
+    }
+    hash_state total;
+    hash_init(&total, 0);
+    for (state_hash_section section = 0; section < STATE_HASH_MAX; section++) {
+        hash_state state;
+        hash_init(&state, 0);
+        switch (section) {
+            case STATE_HASH_BUILDINGS:
+                hash_buildings(&state);
+                break;
+            case STATE_HASH_FIGURES:
+                hash_figures(&state);
+                break;
+            case STATE_HASH_TERRAIN:
+                hash_grid(&state, map_terrain_save_state);
+                break;
+            case STATE_HASH_DESIRABILITY:
+                hash_grid(&state, map_desirability_save_state);
+                break;
+            case STATE_HASH_ROUTING:
+                hash_routing(&state);
+                break;
+            case STATE_HASH_ROAD_NETWORK:
+                hash_grid(&state, map_road_network_write_state);
+                break;
+            case STATE_HASH_CITY:
+                hash_city(&state);
+                break;
+            default:
+                break;
+        }
+        hash->sections[section] = hash_digest(&state);
+        hash_update(&total, &hash->sections[section], sizeof(uint64_t));
+    }
+    hash->total = hash_digest(&total);
+}
+
+const char *game_state_hash_section_name(state_hash_section section)
+{
+    return section < STATE_HASH_MAX ? SECTION_NAMES[section] : "";
+}
+
+void game_state_hash_log(const state_hash *hash)
+{
+    char text[20];
+    for (state_hash_section section = 0; section < STATE_HASH_MAX; section++) {
+        snprintf(text, sizeof(text), "%016" PRIx64, hash->sections[section]);
+        log_info(SECTION_NAMES[section], text, 0);
+    }
+    snprintf(text, sizeof(text), "%016" PRIx64, hash->total);
+    log_info("State hash", text, 0);
+}
@@ -0,0 +1,46 @@
+#ifndef GAME_STATE_HASH_H
+#define GAME_STATE_HASH_H
+
+#include <stdint.h>
+
+/**
+ * @file
+ * Hashing of the simulation state, to verify that two runs of the game produce exactly the same results.
+ */
+
+typedef enum {
+    STATE_HASH_BUILDINGS = 0,
+    STATE_HASH_FIGURES = 1,
+    STATE_HASH_TERRAIN = 2,
+    STATE_HASH_DESIRABILITY = 3,
+    STATE_HASH_ROUTING = 4,
+    STATE_HASH_ROAD_NETWORK = 5,
+    STATE_HASH_CITY = 6,
+    STATE_HASH_MAX
+} state_hash_section;
+
+typedef struct {
+    uint64_t total;
+    uint64_t sections[STATE_HASH_MAX];
+} state_hash;
+
+/**
+ * Calculates the hash of the current simulation state. Does not change the state.
+ * @param hash Hash to fill
+ */
+void game_state_hash_calculate(state_hash *hash);
+
+/**
+ * Gets the name of a section of the hash
+ * @param section Section
+ * @return Name of the section
+ */
+const char *game_state_hash_section_name(state_hash_section section);
+
+/**
+ * Writes the hash to the log
+ * @param hash Hash to log
+ */
+void game_state_hash_log(const state_hash *hash);
+
+#endif // GAME_STATE_HASH_H
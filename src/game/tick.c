@@ -31,6 +31,7 @@
 #include "city/sentiment.h"
 #include "city/trade.h"
 #include "city/victory.h"
+#include "core/arena.h"
 #include "core/config.h"
 #include "core/dir.h"
 #include "core/random.h"
@@ -39,6 +40,7 @@
 #include "figure/formation.h"
 #include "figuretype/crime.h"
 #include "game/file.h"
+#include "game/replay.h"
 #include "game/settings.h"
 #include "game/time.h"
 #include "game/tutorial.h"
@@ -195,13 +197,14 @@ static void advance_tick(void)
     }
 }
 
-void game_tick_run(void)
+static void run_tick(void)
 {
     if (editor_is_active()) {
         random_generate_next(); // update random to randomize native huts
         figure_action_handle(); // just update the flag figures
         return;
     }
+    game_replay_record_tick();
     random_generate_next();
     game_undo_reduce_time_available();
     advance_tick();
@@ -212,6 +215,13 @@ void game_tick_run(void)
     city_victory_check();
 }
 
+void game_tick_run(void)
+{
+    arena_begin(ARENA_LIFETIME_TICK);
+    run_tick();
+    arena_end(ARENA_LIFETIME_TICK);
+}
+
 void game_tick_cheat_year(void)
 {
     advance_year();
@@ -15,6 +15,7 @@
 #include "core/calc.h"
 #include "core/image.h"
 #include "figure/roamer_preview.h"
+#include "game/replay.h"
 #include "game/resource.h"
 #include "graphics/window.h"
 #include "map/aqueduct.h"
@@ -213,6 +214,7 @@ void game_undo_perform(void)
     if (!game_can_undo()) {
         return;
     }
+    game_replay_record_command(REPLAY_COMMAND_UNDO, 0, 0, 0);
     data.available = 0;
     city_finance_process_construction(-data.building_cost);
     if (data.type == BUILDING_CLEAR_LAND) {
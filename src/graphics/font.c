@@ -4,6 +4,9 @@
 #include "core/encoding_trad_chinese.h"
 #include "core/image.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 static int image_y_offset_none(uint8_t c, int image_height, int line_height);
 static int image_y_offset_default(uint8_t c, int image_height, int line_height);
 static int image_y_offset_eastern(uint8_t c, int image_height, int line_height);
@@ -246,10 +249,13 @@ enum {
     MULTIBYTE_JAPANESE = 4,
 };
 
+#define MULTIBYTE_CHAR_CACHE_SIZE 0x10000
+
 static struct {
     const int *font_mapping;
     const font_definition *font_definitions;
     int multibyte;
+    uint16_t *multibyte_char_cache; // character id + 2 for each two byte code, 0 when not looked up yet
 } data;
 
 static int image_y_offset_none(uint8_t c, int image_height, int line_height)
@@ -503,6 +509,9 @@ static int image_y_offset_japanese(uint8_t c, int image_height, int line_height)
 
 void font_set_encoding(encoding_type encoding)
 {
+    if (data.multibyte_char_cache) {
+        memset(data.multibyte_char_cache, 0, sizeof(uint16_t) * MULTIBYTE_CHAR_CACHE_SIZE);
+    }
     data.multibyte = MULTIBYTE_NONE;
     if (encoding == ENCODING_EASTERN_EUROPE) {
         data.font_mapping = CHAR_TO_FONT_IMAGE_EASTERN;
@@ -549,50 +558,73 @@ int font_can_display(const uint8_t *character)
     return font_letter_id(&data.font_definitions[FONT_NORMAL_BLACK], character, &dummy) >= 0;
 }
 
-int font_letter_id(const font_definition *def, const uint8_t *str, int *num_bytes)
+static int lookup_multibyte_char_id(const uint8_t *str)
 {
-    if (data.multibyte != MULTIBYTE_NONE && *str >= 0x80) {
-        *num_bytes = 2;
-        if (data.multibyte == MULTIBYTE_TRADITIONAL_CHINESE) {
-            int char_id = (str[0] & 0x7f) | ((str[1] & 0x7f) << 7);
-            if (char_id >= IMAGE_FONT_MULTIBYTE_TRAD_CHINESE_MAX_CHARS) {
-                // lookup in table
-                int big5_encoded = str[0] << 8 | str[1];
-                char_id = encoding_trad_chinese_big5_to_image_id(big5_encoded);
-                if (char_id < 0 || char_id >= IMAGE_FONT_MULTIBYTE_TRAD_CHINESE_MAX_CHARS) {
-                    return -1;
-                }
-            }
-            return IMAGE_FONT_MULTIBYTE_OFFSET + def->multibyte_image_offset + char_id;
-        } else if (data.multibyte == MULTIBYTE_SIMPLIFIED_CHINESE) {
-            int char_id = (str[0] & 0x7f) | ((str[1] & 0x7f) << 7);
-            if (char_id >= IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS) {
-                return -1;
-            }
-            return IMAGE_FONT_MULTIBYTE_OFFSET + def->multibyte_image_offset + char_id;
-        } else if (data.multibyte == MULTIBYTE_KOREAN) {
-            int b0 = str[0] - 0xb0;
-            int b1 = str[1] - 0xa1;
-            int char_id = b0 * 94 + b1;
-            if (b0 < 0 || b1 < 0 || char_id < 0 || char_id >= IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS) {
+    if (data.multibyte == MULTIBYTE_TRADITIONAL_CHINESE) {
+        int char_id = (str[0] & 0x7f) | ((str[1] & 0x7f) << 7);
+        if (char_id >= IMAGE_FONT_MULTIBYTE_TRAD_CHINESE_MAX_CHARS) {
+            // lookup in table
+            int big5_encoded = str[0] << 8 | str[1];
+            char_id = encoding_trad_chinese_big5_to_image_id(big5_encoded);
+            if (char_id < 0 || char_id >= IMAGE_FONT_MULTIBYTE_TRAD_CHINESE_MAX_CHARS) {
                 return -1;
             }
-            return IMAGE_FONT_MULTIBYTE_OFFSET + def->multibyte_image_offset + char_id;
-        } else if (data.multibyte == MULTIBYTE_JAPANESE) {
-            int char_id;
-            if (str[0] >= 0xa0 && str[0] < 0xe0) {
-                *num_bytes = 1;
-                char_id = encoding_japanese_sjis_to_image_id(str[0], 0);
-            } else {
-                char_id = encoding_japanese_sjis_to_image_id(str[0], str[1]);
-            }
-            if (char_id == -1) {
-                return -1;
-            }
-            return IMAGE_FONT_MULTIBYTE_OFFSET + def->multibyte_image_offset + char_id;
+        }
+        return char_id;
+    } else if (data.multibyte == MULTIBYTE_SIMPLIFIED_CHINESE) {
+        int char_id = (str[0] & 0x7f) | ((str[1] & 0x7f) << 7);
+        if (char_id >= IMAGE_FONT_MULTIBYTE_SIMP_CHINESE_MAX_CHARS) {
+            return -1;
+        }
+        return char_id;
+    } else if (data.multibyte == MULTIBYTE_KOREAN) {
+        int b0 = str[0] - 0xb0;
+        int b1 = str[1] - 0xa1;
+        int char_id = b0 * 94 + b1;
+        if (b0 < 0 || b1 < 0 || char_id < 0 || char_id >= IMAGE_FONT_MULTIBYTE_KOREAN_MAX_CHARS) {
+            return -1;
+        }
+        return char_id;
+    } else if (data.multibyte == MULTIBYTE_JAPANESE) {
+        if (str[0] >= 0xa0 && str[0] < 0xe0) {
+            return encoding_japanese_sjis_to_image_id(str[0], 0);
         } else {
+            return encoding_japanese_sjis_to_image_id(str[0], str[1]);
+        }
+    } else {
+        return -1;
+    }
+}
+
+static int get_multibyte_char_id(const uint8_t *str)
+{
+    // Some characters need a table search, remember the result for each two byte code
+    if (!data.multibyte_char_cache) {
+        data.multibyte_char_cache = calloc(MULTIBYTE_CHAR_CACHE_SIZE, sizeof(uint16_t));
+        if (!data.multibyte_char_cache) {
+            return lookup_multibyte_char_id(str);
+        }
+    }
+    int code = str[0] << 8 | str[1];
+    if (!data.multibyte_char_cache[code]) {
+        data.multibyte_char_cache[code] = (uint16_t) (lookup_multibyte_char_id(str) + 2);
+    }
+    return data.multibyte_char_cache[code] - 2;
+}
+
+int font_letter_id(const font_definition *def, const uint8_t *str, int *num_bytes)
+{
+    if (data.multibyte != MULTIBYTE_NONE && *str >= 0x80) {
+        if (data.multibyte == MULTIBYTE_JAPANESE && str[0] >= 0xa0 && str[0] < 0xe0) {
+            *num_bytes = 1; // half width katakana
+        } else {
+            *num_bytes = 2;
+        }
+        int char_id = get_multibyte_char_id(str);
+        if (char_id < 0) {
             return -1;
         }
+        return IMAGE_FONT_MULTIBYTE_OFFSET + def->multibyte_image_offset + char_id;
     } else {
         *num_bytes = 1;
         if (!data.font_mapping[*str]) {
@@ -10,11 +10,21 @@
 #include "map/ring.h"
 #include "map/terrain.h"
 
+#define MAX_PYRAMID_LEVELS 3
+
 static grid_i8 desirability_grid;
 
+// Each level holds the maximum desirability of the block starting at each tile, with the block size
+// doubling on every level (2x2, 4x4, 8x8), so the maximum of a building footprint takes four lookups
+static struct {
+    grid_i8 levels[MAX_PYRAMID_LEVELS];
+    int levels_built;
+} max_pyramid;
+
 void map_desirability_clear(void)
 {
     map_grid_clear_i8(desirability_grid.items);
+    max_pyramid.levels_built = 0;
 }
 
 static void add_desirability_at_distance(int x, int y, int size, int distance, int desirability)
@@ -206,11 +216,70 @@ int map_desirability_get(int grid_offset)
     return desirability_grid.items[grid_offset];
 }
 
+static void update_max_pyramid(int levels)
+{
+    for (int level = max_pyramid.levels_built; level < levels; level++) {
+        const int8_t *previous = level ? max_pyramid.levels[level - 1].items : desirability_grid.items;
+        int8_t *current = max_pyramid.levels[level].items;
+        int half = 1 << level;
+        int last = GRID_SIZE - 2 * half;
+        for (int y = 0; y <= last; y++) {
+            int grid_offset = y * GRID_SIZE;
+            for (int x = 0; x <= last; x++, grid_offset++) {
+                int max = previous[grid_offset];
+                if (previous[grid_offset + half] > max) {
+                    max = previous[grid_offset + half];
+                }
+                if (previous[grid_offset + half * GRID_SIZE] > max) {
+                    max = previous[grid_offset + half * GRID_SIZE];
+                }
+                if (previous[grid_offset + half * GRID_SIZE + half] > max) {
+                    max = previous[grid_offset + half * GRID_SIZE + half];
+                }
+                current[grid_offset] = max;
+            }
+        }
+    }
+    max_pyramid.levels_built = levels;
+}
+
+static int get_max_from_pyramid(int x, int y, int size)
+{
+    int level = 0;
+    while ((2 << level) <= size) {
+        level++;
+    }
+    if (max_pyramid.levels_built < level) {
+        update_max_pyramid(level);
+    }
+    const int8_t *items = max_pyramid.levels[level - 1].items;
+    int far = size - (1 << level);
+    int max = items[map_grid_offset(x, y)];
+    int value = items[map_grid_offset(x + far, y)];
+    if (value > max) {
+        max = value;
+    }
+    value = items[map_grid_offset(x, y + far)];
+    if (value > max) {
+        max = value;
+    }
+    value = items[map_grid_offset(x + far, y + far)];
+    if (value > max) {
+        max = value;
+    }
+    return max;
+}
+
 int map_desirability_get_max(int x, int y, int size)
 {
     if (size == 1) {
         return desirability_grid.items[map_grid_offset(x, y)];
     }
+    // Almost all buildings are up to 3 tiles wide, for which reading the tiles is cheapest.
+    // Only the levels of the pyramid that wider buildings need are built.
+    if (size > 3 && size < (2 << MAX_PYRAMID_LEVELS)) {
+        return get_max_from_pyramid(x, y, size);
+    }
     int max = -9999;
     for (int dy = 0; dy < size; dy++) {
         for (int dx = 0; dx < size; dx++) {
@@ -231,4 +300,5 @@ void map_desirability_save_state(buffer *buf)
 void map_desirability_load_state(buffer *buf)
 {
     map_grid_load_state_i8(desirability_grid.items, buf);
+    max_pyramid.levels_built = 0;
 }
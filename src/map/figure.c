@@ -2,8 +2,21 @@
 
 #include "map/grid.h"
 
+#include <string.h>
+
+#define AREA_SIZE_SHIFT 3
+#define AREAS_PER_ROW (256 >> AREA_SIZE_SHIFT)
+#define AREA_LISTS (AREAS_PER_ROW * AREAS_PER_ROW * MAP_FIGURE_CATEGORY_MAX)
+
 static grid_u16 figures;
 
+// Coarse index of the figures on the map, split into square areas and figure categories, so that
+// searches around a tile only need to look at the figures nearby. It mirrors the tile lists above.
+static struct {
+    short first_figure_id[AREA_LISTS];
+    int needs_rebuild;
+} areas = { .needs_rebuild = 1 };
+
 int map_has_figure_at(int grid_offset)
 {
     return map_grid_is_valid_offset(grid_offset) && figures.items[grid_offset] > 0;
@@ -21,11 +34,81 @@ static void cap_figures_on_same_tile_index(figure *f)
     }
 }
 
+static int get_category(const figure *f)
+{
+    if (figure_is_legion(f)) {
+        return MAP_FIGURE_CATEGORY_SOLDIER;
+    }
+    if (figure_is_enemy(f) || figure_is_herd(f) || f->type == FIGURE_RIOTER || f->type == FIGURE_INDIGENOUS_NATIVE) {
+        return MAP_FIGURE_CATEGORY_HOSTILE;
+    }
+    return MAP_FIGURE_CATEGORY_OTHER;
+}
+
+static int get_area(int x, int y)
+{
+    return (y >> AREA_SIZE_SHIFT) * AREAS_PER_ROW + (x >> AREA_SIZE_SHIFT);
+}
+
+static void add_to_area(figure *f)
+{
+    if (!f->id) {
+        return;
+    }
+    int list = get_area(f->x, f->y) * MAP_FIGURE_CATEGORY_MAX + get_category(f);
+    f->previous_figure_id_in_area = 0;
+    f->next_figure_id_in_area = areas.first_figure_id[list];
+    if (f->next_figure_id_in_area) {
+        figure_get(f->next_figure_id_in_area)->previous_figure_id_in_area = f->id;
+    }
+    areas.first_figure_id[list] = f->id;
+    f->area_list = list + 1;
+}
+
+static void remove_from_area(figure *f)
+{
+    if (!f->area_list) {
+        return;
+    }
+    if (f->previous_figure_id_in_area) {
+        figure_get(f->previous_figure_id_in_area)->next_figure_id_in_area = f->next_figure_id_in_area;
+    } else {
+        areas.first_figure_id[f->area_list - 1] = f->next_figure_id_in_area;
+    }
+    if (f->next_figure_id_in_area) {
+        figure_get(f->next_figure_id_in_area)->previous_figure_id_in_area = f->previous_figure_id_in_area;
+    }
+    f->next_figure_id_in_area = 0;
+    f->previous_figure_id_in_area = 0;
+    f->area_list = 0;
+}
+
+static void rebuild_areas(void)
+{
+    memset(areas.first_figure_id, 0, sizeof(areas.first_figure_id));
+    for (int i = 1; i < figure_count(); i++) {
+        figure_get(i)->area_list = 0;
+    }
+    for (int grid_offset = 0; grid_offset < GRID_SIZE * GRID_SIZE; grid_offset++) {
+        int figure_id = figures.items[grid_offset];
+        while (figure_id) {
+            figure *f = figure_get(figure_id);
+            add_to_area(f);
+            figure_id = f->next_figure_id_on_same_tile;
+        }
+    }
+    areas.needs_rebuild = 0;
+}
+
 void map_figure_add(figure *f)
 {
     if (!map_grid_is_valid_offset(f->grid_offset)) {
         return;
     }
+    if (!areas.needs_rebuild) {
+        remove_from_area(f);
+        add_to_area(f);
+    }
     f->figures_on_same_tile_index = 0;
     f->next_figure_id_on_same_tile = 0;
 
@@ -62,8 +145,19 @@ void map_figure_update(figure *f)
     cap_figures_on_same_tile_index(f);
 }
 
+void map_figure_update_category(figure *f)
+{
+    if (f->area_list && !areas.needs_rebuild) {
+        remove_from_area(f);
+        add_to_area(f);
+    }
+}
+
 void map_figure_delete(figure *f)
 {
+    if (!areas.needs_rebuild) {
+        remove_from_area(f);
+    }
     if (!map_grid_is_valid_offset(f->grid_offset) || !figures.items[f->grid_offset]) {
         f->next_figure_id_on_same_tile = 0;
         return;
@@ -96,9 +190,51 @@ int map_figure_foreach_until(int grid_offset, int (*callback)(figure *f))
     return 0;
 }
 
+static void foreach_in_areas(int x_min, int y_min, int x_max, int y_max, int categories,
+    void (*callback)(figure *f))
+{
+    if (areas.needs_rebuild) {
+        rebuild_areas();
+    }
+    for (int y = y_min; y <= y_max; y++) {
+        for (int x = x_min; x <= x_max; x++) {
+            int list = get_area(x << AREA_SIZE_SHIFT, y << AREA_SIZE_SHIFT) * MAP_FIGURE_CATEGORY_MAX;
+            for (int category = 0; category < MAP_FIGURE_CATEGORY_MAX; category++) {
+                if (!(categories & (1 << category))) {
+                    continue;
+                }
+                int figure_id = areas.first_figure_id[list + category];
+                while (figure_id) {
+                    figure *f = figure_get(figure_id);
+                    figure_id = f->next_figure_id_in_area;
+                    callback(f);
+                }
+            }
+        }
+    }
+}
+
+void map_figure_foreach_in_distance(int x, int y, int distance, int categories, void (*callback)(figure *f))
+{
+    if (distance < 0) {
+        return;
+    }
+    int x_min = x - distance < 0 ? 0 : (x - distance) >> AREA_SIZE_SHIFT;
+    int y_min = y - distance < 0 ? 0 : (y - distance) >> AREA_SIZE_SHIFT;
+    int x_max = x + distance >= 255 ? AREAS_PER_ROW - 1 : (x + distance) >> AREA_SIZE_SHIFT;
+    int y_max = y + distance >= 255 ? AREAS_PER_ROW - 1 : (y + distance) >> AREA_SIZE_SHIFT;
+    foreach_in_areas(x_min, y_min, x_max, y_max, categories, callback);
+}
+
+void map_figure_foreach_of_category(int categories, void (*callback)(figure *f))
+{
+    foreach_in_areas(0, 0, AREAS_PER_ROW - 1, AREAS_PER_ROW - 1, categories, callback);
+}
+
 void map_figure_clear(void)
 {
     map_grid_clear_u16(figures.items);
+    areas.needs_rebuild = 1;
 }
 
 void map_figure_save_state(buffer *buf)
@@ -109,4 +245,5 @@ void map_figure_save_state(buffer *buf)
 void map_figure_load_state(buffer *buf)
 {
     map_grid_load_state_u16(figures.items, buf);
+    areas.needs_rebuild = 1;
 }
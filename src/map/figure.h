@@ -4,6 +4,16 @@
 #include "core/buffer.h"
 #include "figure/figure.h"
 
+typedef enum {
+    MAP_FIGURE_CATEGORY_SOLDIER = 0,
+    MAP_FIGURE_CATEGORY_HOSTILE = 1, // enemies, rioters, natives and animals
+    MAP_FIGURE_CATEGORY_OTHER = 2,
+    MAP_FIGURE_CATEGORY_MAX = 3
+} map_figure_category;
+
+#define MAP_FIGURE_CATEGORY_FLAG(category) (1 << (category))
+#define MAP_FIGURE_CATEGORY_ALL ((1 << MAP_FIGURE_CATEGORY_MAX) - 1)
+
 /**
  * Returns the first figure at the given offset
  * @param grid_offset Map offset
@@ -24,8 +34,33 @@ void map_figure_update(figure *f);
 
 void map_figure_delete(figure *f);
 
+/**
+ * Moves the figure to the right category after its type changed
+ * @param f Figure whose type changed
+ */
+void map_figure_update_category(figure *f);
+
 int map_figure_foreach_until(int grid_offset, int (*callback)(figure *f));
 
+/**
+ * Calls the callback for all figures of the given categories that are on the map near the given tile.
+ * This includes every figure within the distance, but can also include figures slightly further away,
+ * so the callback should check the actual distance. The callback must not add or remove figures.
+ * @param x X tile to search from
+ * @param y Y tile to search from
+ * @param distance Maximum distance to search
+ * @param categories Bitmask of MAP_FIGURE_CATEGORY_FLAG values
+ * @param callback Function to call for each figure
+ */
+void map_figure_foreach_in_distance(int x, int y, int distance, int categories, void (*callback)(figure *f));
+
+/**
+ * Calls the callback for all figures of the given categories that are on the map
+ * @param categories Bitmask of MAP_FIGURE_CATEGORY_FLAG values
+ * @param callback Function to call for each figure
+ */
+void map_figure_foreach_of_category(int categories, void (*callback)(figure *f));
+
 /**
  * Clears the map
  */
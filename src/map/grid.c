@@ -1,6 +1,7 @@
 #include "grid.h"
 
 #include "building/building.h"
+#include "core/arena.h"
 #include "core/log.h"
 #include "map/building.h"
 #include "map/data.h"
@@ -56,21 +57,26 @@ void map_grid_init(int width, int height, int start_offset, int border_size)
     map_data.border_size = border_size;
 }
 
-static grid_slice *allocate_grid_slice_memory(void)
+static grid_slice *allocate_grid_slice_memory(int capacity)
 {
-    grid_slice *slice = malloc(sizeof(grid_slice));
+    if (capacity < 0) {
+        capacity = 0;
+    } else if (capacity > MAX_SLICE_SIZE) {
+        capacity = MAX_SLICE_SIZE;
+    }
+    grid_slice *slice = arena_alloc(sizeof(grid_slice) + capacity * sizeof(int));
     if (!slice) {
         log_error("Failed to allocate memory for grid_slice. The game will now crash.", 0, 0);
         return NULL;
     }
+    slice->grid_offsets = (int *) (slice + 1);
     slice->size = 0;
-    memset(slice->grid_offsets, -1, sizeof(slice->grid_offsets));
     return slice;
 }
 
 grid_slice *map_grid_get_grid_slice(int *grid_offsets, int size)
 {
-    grid_slice *slice = allocate_grid_slice_memory();
+    grid_slice *slice = allocate_grid_slice_memory(size);
     if (!slice) {
         return NULL;
     }
@@ -98,7 +104,7 @@ grid_slice *map_grid_get_grid_slice_from_corners(int start_x, int start_y, int e
 
 grid_slice *map_grid_get_grid_slice_rectangle(int start_grid_offset, int width, int height)
 {
-    grid_slice *slice = allocate_grid_slice_memory();
+    grid_slice *slice = allocate_grid_slice_memory(width * height);
     if (!slice) {
         return NULL;
     }
@@ -125,7 +131,7 @@ grid_slice *map_grid_get_grid_slice_rectangle(int start_grid_offset, int width,
 grid_slice *map_grid_get_grid_slice_house(int building_id, int check_rubble)
 {
     int found_tiles = 0;
-    grid_slice *slice = allocate_grid_slice_memory();
+    grid_slice *slice = allocate_grid_slice_memory(16);
     building *b = building_get(building_id);
     int starting_x = map_grid_offset_to_x(b->grid_offset);
     int starting_y = map_grid_offset_to_y(b->grid_offset);
@@ -152,7 +158,8 @@ grid_slice *map_grid_get_grid_slice_square(int start_grid_offset, int size)
 
 grid_slice *map_grid_get_grid_slice_ring(int center_grid_offset, int inner_radius, int outer_radius)
 {
-    grid_slice *slice = allocate_grid_slice_memory();
+    int diameter = 2 * outer_radius + 1;
+    grid_slice *slice = allocate_grid_slice_memory(diameter > GRID_SIZE ? MAX_SLICE_SIZE : diameter * diameter);
     if (!slice) {
         return NULL;
     }
@@ -15,11 +15,14 @@ enum {
  * Used to store multiple grid coordinates as a contiguous array of offsets,
  * for operations on groups of tiles - allows easy iteration through uneven shapes
  *
- * @param grid_offsets Array containing the grid offset positions
+ * Slices are taken from the scratch arena (see core/arena.h): they must not be freed
+ * and are only valid until the current frame or game tick ends.
+ *
+ * @param grid_offsets Array containing the grid offset positions, sized for the shape of the slice
  * @param size 1-based count of valid entries in grid_offsets, 0 means empty arrray, 1 means [0] is valid, etc.
  */
 typedef struct grid_slice {
-    int grid_offsets[MAX_SLICE_SIZE];
+    int *grid_offsets;
     int size;
 } grid_slice;
 
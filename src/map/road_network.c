@@ -13,6 +13,10 @@
 static const int ADJACENT_OFFSETS[] = {-GRID_SIZE, 1, GRID_SIZE, -1};
 
 static grid_u8 network;
+static grid_u8 network_tiles;
+
+static int needs_update = 1;
+static unsigned int generation;
 
 static struct {
     int items[MAX_QUEUE];
@@ -23,6 +27,9 @@ static struct {
 void map_road_network_clear(void)
 {
     map_grid_clear_u8(network.items);
+    map_grid_clear_u8(network_tiles.items);
+    needs_update = 1;
+    generation++;
 }
 
 int map_road_network_get(int grid_offset)
@@ -30,6 +37,36 @@ int map_road_network_get(int grid_offset)
     return network.items[grid_offset];
 }
 
+static uint8_t get_network_tile_type(int grid_offset)
+{
+    uint8_t type = 0;
+    if (map_terrain_is(grid_offset, TERRAIN_ROAD)) {
+        type |= 1;
+    }
+    if (map_routing_citizen_is_passable(grid_offset) && (
+        map_routing_citizen_is_road(grid_offset) ||
+        map_terrain_is(grid_offset, TERRAIN_ACCESS_RAMP) ||
+        map_routing_citizen_is_highway(grid_offset))) {
+        type |= 2;
+    }
+    return type;
+}
+
+void map_road_network_check_tile(int grid_offset)
+{
+    uint8_t type = get_network_tile_type(grid_offset);
+    if (network_tiles.items[grid_offset] != type) {
+        network_tiles.items[grid_offset] = type;
+        needs_update = 1;
+        generation++;
+    }
+}
+
+unsigned int map_road_network_generation(void)
+{
+    return generation;
+}
+
 static int mark_road_network(int grid_offset, uint8_t network_id)
 {
     memset(&queue, 0, sizeof(queue));
@@ -79,6 +116,10 @@ static int mark_road_network(int grid_offset, uint8_t network_id)
 
 void map_road_network_update(void)
 {
+    if (!needs_update) {
+        return;
+    }
+    needs_update = 0;
     city_map_clear_largest_road_networks();
     map_grid_clear_u8(network.items);
     int network_id = 1;
@@ -93,3 +134,8 @@ void map_road_network_update(void)
         }
     }
 }
+
+void map_road_network_write_state(buffer *buf)
+{
+    map_grid_save_state_u8(network.items, buf);
+}
@@ -1,10 +1,31 @@
 #ifndef MAP_ROAD_NETWORK_H
 #define MAP_ROAD_NETWORK_H
 
+#include "core/buffer.h"
+
 void map_road_network_clear(void);
 
 int map_road_network_get(int grid_offset);
 
+/**
+ * Notifies the road network that the routing or terrain data of a tile may have changed.
+ * The networks are only recalculated on the next update if the tile changed its connectivity.
+ * @param grid_offset The tile that was updated
+ */
+void map_road_network_check_tile(int grid_offset);
+
+/**
+ * Recalculates all road networks, if any road tile changed since the last update
+ */
 void map_road_network_update(void);
 
+unsigned int map_road_network_generation(void);
+
+/**
+ * Writes the road networks to the buffer as they are, without updating them.
+ * The networks are not part of saved games, this is only used to compare the state of two runs.
+ * @param buf Buffer to write to, with room for a grid of bytes
+ */
+void map_road_network_write_state(buffer *buf);
+
 #endif // MAP_ROAD_NETWORK_H
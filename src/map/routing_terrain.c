@@ -9,6 +9,7 @@
 #include "map/image.h"
 #include "map/property.h"
 #include "map/random.h"
+#include "map/road_network.h"
 #include "map/routing_data.h"
 #include "map/sprite.h"
 #include "map/terrain.h"
@@ -99,37 +100,43 @@ static int get_land_type_citizen_aqueduct(int grid_offset)
     }
 }
 
+static void update_land_citizen_tile(int grid_offset)
+{
+    int terrain = map_terrain_get(grid_offset);
+    if (terrain & TERRAIN_ROAD) {
+        terrain_land_citizen.items[grid_offset] = CITIZEN_0_ROAD;
+    } else if (terrain & TERRAIN_HIGHWAY) {
+        terrain_land_citizen.items[grid_offset] = CITIZEN_1_HIGHWAY;
+    } else if (terrain & (TERRAIN_RUBBLE | TERRAIN_ACCESS_RAMP | TERRAIN_GARDEN)) {
+        terrain_land_citizen.items[grid_offset] = CITIZEN_2_PASSABLE_TERRAIN;
+    } else if (terrain & (TERRAIN_BUILDING | TERRAIN_GATEHOUSE)) {
+        if (!map_building_at(grid_offset)) {
+            // shouldn't happen
+            terrain_land_noncitizen.items[grid_offset] = CITIZEN_4_CLEAR_TERRAIN; // BUG: should be citizen?
+            map_terrain_remove(grid_offset, TERRAIN_BUILDING);
+            map_image_set(grid_offset, (map_random_get(grid_offset) & 7) + image_group(GROUP_TERRAIN_GRASS_1));
+            map_property_mark_draw_tile(grid_offset);
+            map_property_set_multi_tile_size(grid_offset, 1);
+            return;
+        }
+        terrain_land_citizen.items[grid_offset] = get_land_type_citizen_building(grid_offset);
+    } else if (terrain & TERRAIN_AQUEDUCT) {
+        terrain_land_citizen.items[grid_offset] = get_land_type_citizen_aqueduct(grid_offset);
+    } else if (terrain & TERRAIN_NOT_CLEAR) {
+        terrain_land_citizen.items[grid_offset] = CITIZEN_N1_BLOCKED;
+    } else {
+        terrain_land_citizen.items[grid_offset] = CITIZEN_4_CLEAR_TERRAIN;
+    }
+}
+
 void map_routing_update_land_citizen(void)
 {
     map_grid_init_i8(terrain_land_citizen.items, -1);
     int grid_offset = map_data.start_offset;
     for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
         for (int x = 0; x < map_data.width; x++, grid_offset++) {
-            int terrain = map_terrain_get(grid_offset);
-            if (terrain & TERRAIN_ROAD) {
-                terrain_land_citizen.items[grid_offset] = CITIZEN_0_ROAD;
-            } else if (terrain & TERRAIN_HIGHWAY) {
-                terrain_land_citizen.items[grid_offset] = CITIZEN_1_HIGHWAY;
-            } else if (terrain & (TERRAIN_RUBBLE | TERRAIN_ACCESS_RAMP | TERRAIN_GARDEN)) {
-                terrain_land_citizen.items[grid_offset] = CITIZEN_2_PASSABLE_TERRAIN;
-            } else if (terrain & (TERRAIN_BUILDING | TERRAIN_GATEHOUSE)) {
-                if (!map_building_at(grid_offset)) {
-                    // shouldn't happen
-                    terrain_land_noncitizen.items[grid_offset] = CITIZEN_4_CLEAR_TERRAIN; // BUG: should be citizen?
-                    map_terrain_remove(grid_offset, TERRAIN_BUILDING);
-                    map_image_set(grid_offset, (map_random_get(grid_offset) & 7) + image_group(GROUP_TERRAIN_GRASS_1));
-                    map_property_mark_draw_tile(grid_offset);
-                    map_property_set_multi_tile_size(grid_offset, 1);
-                    continue;
-                }
-                terrain_land_citizen.items[grid_offset] = get_land_type_citizen_building(grid_offset);
-            } else if (terrain & TERRAIN_AQUEDUCT) {
-                terrain_land_citizen.items[grid_offset] = get_land_type_citizen_aqueduct(grid_offset);
-            } else if (terrain & TERRAIN_NOT_CLEAR) {
-                terrain_land_citizen.items[grid_offset] = CITIZEN_N1_BLOCKED;
-            } else {
-                terrain_land_citizen.items[grid_offset] = CITIZEN_4_CLEAR_TERRAIN;
-            }
+            update_land_citizen_tile(grid_offset);
+            map_road_network_check_tile(grid_offset);
         }
     }
 }
@@ -189,32 +196,55 @@ static int get_land_type_noncitizen(int grid_offset)
     return type;
 }
 
+static void update_land_noncitizen_tile(int grid_offset)
+{
+    int terrain = map_terrain_get(grid_offset);
+    if (terrain & TERRAIN_GATEHOUSE) {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_4_GATEHOUSE;
+    } else if (terrain & TERRAIN_BUILDING) {
+        terrain_land_noncitizen.items[grid_offset] = get_land_type_noncitizen(grid_offset);
+    } else if (terrain & TERRAIN_ROAD) {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_0_PASSABLE;
+    } else if (terrain & TERRAIN_HIGHWAY) {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_0_PASSABLE;
+    } else if (terrain & (TERRAIN_GARDEN | TERRAIN_ACCESS_RAMP | TERRAIN_RUBBLE)) {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_2_CLEARABLE;
+    } else if (terrain & TERRAIN_AQUEDUCT) {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_2_CLEARABLE;
+    } else if (terrain & TERRAIN_WALL) {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_3_WALL;
+    } else if (terrain & TERRAIN_NOT_CLEAR) {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_N1_BLOCKED;
+    } else {
+        terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_0_PASSABLE;
+    }
+}
+
 static void map_routing_update_land_noncitizen(void)
 {
     map_grid_init_i8(terrain_land_noncitizen.items, -1);
     int grid_offset = map_data.start_offset;
     for (int y = 0; y < map_data.height; y++, grid_offset += map_data.border_size) {
         for (int x = 0; x < map_data.width; x++, grid_offset++) {
-            int terrain = map_terrain_get(grid_offset);
-            if (terrain & TERRAIN_GATEHOUSE) {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_4_GATEHOUSE;
-            } else if (terrain & TERRAIN_BUILDING) {
-                terrain_land_noncitizen.items[grid_offset] = get_land_type_noncitizen(grid_offset);
-            } else if (terrain & TERRAIN_ROAD) {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_0_PASSABLE;
-            } else if (terrain & TERRAIN_HIGHWAY) {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_0_PASSABLE;
-            } else if (terrain & (TERRAIN_GARDEN | TERRAIN_ACCESS_RAMP | TERRAIN_RUBBLE)) {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_2_CLEARABLE;
-            } else if (terrain & TERRAIN_AQUEDUCT) {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_2_CLEARABLE;
-            } else if (terrain & TERRAIN_WALL) {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_3_WALL;
-            } else if (terrain & TERRAIN_NOT_CLEAR) {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_N1_BLOCKED;
-            } else {
-                terrain_land_noncitizen.items[grid_offset] = NONCITIZEN_0_PASSABLE;
-            }
+            update_land_noncitizen_tile(grid_offset);
+        }
+    }
+}
+
+void map_routing_update_land_area(int x, int y, int size)
+{
+    // The land types of a tile only depend on the tile itself, so only the area needs to be updated
+    int x_min = x;
+    int y_min = y;
+    int x_max = x + size - 1;
+    int y_max = y + size - 1;
+    map_grid_bound_area(&x_min, &y_min, &x_max, &y_max);
+    for (int yy = y_min; yy <= y_max; yy++) {
+        for (int xx = x_min; xx <= x_max; xx++) {
+            int grid_offset = map_grid_offset(xx, yy);
+            update_land_citizen_tile(grid_offset);
+            map_road_network_check_tile(grid_offset);
+            update_land_noncitizen_tile(grid_offset);
         }
     }
 }
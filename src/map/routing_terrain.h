@@ -4,6 +4,7 @@
 void map_routing_update_all(void);
 void map_routing_update_land(void);
 void map_routing_update_land_citizen(void);
+void map_routing_update_land_area(int x, int y, int size);
 void map_routing_update_water(void);
 void map_routing_update_walls(void);
 
@@ -7,15 +7,44 @@
 
 static grid_u8 strength;
 
+// Bounds of the tiles that have a strength, so searches can skip the rest of the map
+static struct {
+    int x_min;
+    int y_min;
+    int x_max;
+    int y_max;
+} area = { GRID_SIZE, GRID_SIZE, -1, -1 };
+
 void map_soldier_strength_clear(void)
 {
     map_grid_clear_u8(strength.items);
+    area.x_min = GRID_SIZE;
+    area.y_min = GRID_SIZE;
+    area.x_max = -1;
+    area.y_max = -1;
+}
+
+static void extend_area(int x_min, int y_min, int x_max, int y_max)
+{
+    if (x_min < area.x_min) {
+        area.x_min = x_min;
+    }
+    if (y_min < area.y_min) {
+        area.y_min = y_min;
+    }
+    if (x_max > area.x_max) {
+        area.x_max = x_max;
+    }
+    if (y_max > area.y_max) {
+        area.y_max = y_max;
+    }
 }
 
 void map_soldier_strength_add(int x, int y, int radius, int amount)
 {
     int x_min, y_min, x_max, y_max;
     map_grid_get_area(x, y, 1, radius, &x_min, &y_min, &x_max, &y_max);
+    extend_area(x_min, y_min, x_max, y_max);
 
     for (int yy = y_min; yy <= y_max; yy++) {
         for (int xx = x_min; xx <= x_max; xx++) {
@@ -40,6 +69,12 @@ int map_soldier_strength_get_max(int x, int y, int radius, int *out_x, int *out_
     int x_min, y_min, x_max, y_max;
     map_grid_get_area(x, y, 1, radius, &x_min, &y_min, &x_max, &y_max);
 
+    // Tiles outside the area have no strength and can never be the maximum
+    x_min = x_min > area.x_min ? x_min : area.x_min;
+    y_min = y_min > area.y_min ? y_min : area.y_min;
+    x_max = x_max < area.x_max ? x_max : area.x_max;
+    y_max = y_max < area.y_max ? y_max : area.y_max;
+
     int max_value = 0;
     int max_tile_x = 0, max_tile_y = 0;
     for (int yy = y_min; yy <= y_max; yy++) {
@@ -14,6 +14,8 @@
 static grid_u32 terrain_grid;
 static grid_u32 terrain_grid_backup;
 
+static unsigned int changed_terrain = ~0u;
+
 
 const terrain_flags_array *map_terrain_to_array(int grid_offset)
 {
@@ -89,16 +91,19 @@ int map_terrain_get_from_buffer_32(buffer *buf, int grid_offset)
 
 void map_terrain_set(int grid_offset, int terrain)
 {
+    changed_terrain |= terrain_grid.items[grid_offset] ^ terrain;
     terrain_grid.items[grid_offset] = terrain;
 }
 
 void map_terrain_add(int grid_offset, int terrain)
 {
+    changed_terrain |= terrain & ~terrain_grid.items[grid_offset];
     terrain_grid.items[grid_offset] |= terrain;
 }
 
 void map_terrain_remove(int grid_offset, int terrain)
 {
+    changed_terrain |= terrain & terrain_grid.items[grid_offset];
     terrain_grid.items[grid_offset] &= ~terrain;
 }
 
@@ -128,9 +133,17 @@ void map_terrain_remove_with_radius(int x, int y, int size, int radius, int terr
 
 void map_terrain_remove_all(int terrain)
 {
+    changed_terrain |= terrain;
     map_grid_and_u32(terrain_grid.items, ~terrain);
 }
 
+int map_terrain_check_changed(int terrain)
+{
+    int changed = (changed_terrain & terrain) != 0;
+    changed_terrain &= ~terrain;
+    return changed;
+}
+
 int map_terrain_count_directly_adjacent_with_type(int grid_offset, int terrain)
 {
     int count = 0;
@@ -450,11 +463,13 @@ void map_terrain_backup(void)
 void map_terrain_restore(void)
 {
     map_grid_copy_u32(terrain_grid_backup.items, terrain_grid.items);
+    changed_terrain = ~0u;
 }
 
 void map_terrain_clear(void)
 {
     map_grid_clear_u32(terrain_grid.items);
+    changed_terrain = ~0u;
 }
 
 void map_terrain_init_outside_map(void)
@@ -640,4 +655,5 @@ void map_terrain_load_state(buffer *buf, int expanded_terrain_data, buffer *imag
         map_grid_load_state_u16_to_u32(terrain_grid.items, buf);
     }
     determine_original_trees(images, legacy_image_buffer);
+    changed_terrain = ~0u;
 }
@@ -98,6 +98,14 @@ void map_terrain_remove_with_radius(int x, int y, int size, int radius, int terr
 
 void map_terrain_remove_all(int terrain);
 
+/**
+ * Checks whether any tile gained or lost one of the terrain types since the last check for that type.
+ * The change tracking for the given types is reset afterwards.
+ * @param terrain Terrain bitmask to be checked for.
+ * @return 1 if any of the terrain types changed, 0 otherwise.
+ */
+int map_terrain_check_changed(int terrain);
+
 /**
  * Check orthogonal neighbours of a tile if they contain a terrain.
  * @param grid_offset Tile which neighbours will be checked.
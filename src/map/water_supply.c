@@ -37,6 +37,8 @@ static struct {
     int tail;
 } queue;
 
+static unsigned int reservoir_signature;
+
 static void mark_well_access(int well_id, int radius)
 {
     building *well = building_get(well_id);
@@ -189,16 +191,40 @@ static void fill_aqueducts_from_offset(int grid_offset)
     } while (next_offset > -1);
 }
 
-void map_water_supply_update_reservoir_fountain(void)
+static int reservoir_has_natural_water(const building *b)
+{
+    return map_terrain_exists_tile_in_area_with_type(b->x - 1, b->y - 1, 5, TERRAIN_WATER);
+}
+
+static int aqueduct_network_changed(void)
+{
+    // Aqueduct water only depends on the aqueduct tiles and on the reservoirs connected to them,
+    // so the network only needs to be refilled when either of them changed since the last update
+    int aqueducts_changed = map_terrain_check_changed(TERRAIN_AQUEDUCT);
+    unsigned int signature = 0;
+    for (building *b = building_first_of_type(BUILDING_RESERVOIR); b; b = b->next_of_type) {
+        if (b->state != BUILDING_STATE_IN_USE) {
+            continue;
+        }
+        signature = signature * 31 + b->id;
+        signature = signature * 31 + b->grid_offset;
+        signature = signature * 2 + reservoir_has_natural_water(b);
+    }
+    if (aqueducts_changed || signature != reservoir_signature) {
+        reservoir_signature = signature;
+        return 1;
+    }
+    return 0;
+}
+
+static void fill_aqueducts_from_reservoirs(void)
 {
-    map_terrain_remove_all(TERRAIN_FOUNTAIN_RANGE | TERRAIN_RESERVOIR_RANGE);
-    // reservoirs
     set_all_aqueducts_to_no_water();
     for (building *b = building_first_of_type(BUILDING_RESERVOIR); b; b = b->next_of_type) {
         if (b->state != BUILDING_STATE_IN_USE) {
             continue;
         }
-        if (map_terrain_exists_tile_in_area_with_type(b->x - 1, b->y - 1, 5, TERRAIN_WATER)) {
+        if (reservoir_has_natural_water(b)) {
             b->has_water_access = 2;
         } else {
             b->has_water_access = 0;
@@ -221,6 +247,15 @@ void map_water_supply_update_reservoir_fountain(void)
             }
         }
     }
+}
+
+void map_water_supply_update_reservoir_fountain(void)
+{
+    map_terrain_remove_all(TERRAIN_FOUNTAIN_RANGE | TERRAIN_RESERVOIR_RANGE);
+    // reservoirs
+    if (aqueduct_network_changed()) {
+        fill_aqueducts_from_reservoirs();
+    }
     // mark reservoir ranges
     for (building *b = building_first_of_type(BUILDING_RESERVOIR); b; b = b->next_of_type) {
         if (b->state == BUILDING_STATE_IN_USE && b->has_water_access) {
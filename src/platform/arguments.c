@@ -8,6 +8,7 @@
 #define DISPLAY_SCALE_ERROR_MESSAGE "Option --display-scale must be followed by a scale value between 0.5 and 5"
 #define WINDOWED_AND_FULLSCREEN_ERROR_MESSAGE "Option --windowed and --fullscreen cannot both be specified"
 #define DISPLAY_ID_ERROR_MESSAGE "Option --display must be followed by a number indicating the display, starting from 0"
+#define REPLAY_NAME_ERROR_MESSAGE "Option --replay must be followed by the name of a replay"
 #define UNKNOWN_OPTION_ERROR_MESSAGE "Option %s not recognized"
 
 static void print_log(const char *message)
@@ -74,6 +75,7 @@ int platform_parse_arguments(int argc, char **argv, augustus_args *output_args)
     output_args->use_software_cursor = 0;
     output_args->force_fullscreen = 0;
     output_args->display_id = 0;
+    output_args->replay_name = 0;
 
     for (int i = 1; i < argc; i++) {
         // we ignore "-psn" arguments, this is needed to launch the app
@@ -118,6 +120,14 @@ int platform_parse_arguments(int argc, char **argv, augustus_args *output_args)
                 print_log(DISPLAY_ID_ERROR_MESSAGE);
                 ok = 0;
             }
+        } else if (SDL_strcmp(argv[i], "--replay") == 0) {
+            if (i + 1 < argc) {
+                output_args->replay_name = argv[i + 1];
+                i++;
+            } else {
+                print_log(REPLAY_NAME_ERROR_MESSAGE);
+                ok = 0;
+            }
         } else if (SDL_strcmp(argv[i], "--windowed") == 0) {
             output_args->force_windowed = 1;
         } else if (SDL_strcmp(argv[i], "--asset-previewer") == 0) {
@@ -165,6 +175,9 @@ int platform_parse_arguments(int argc, char **argv, augustus_args *output_args)
         print_log("          Enables joystick support");
         print_log("--software-cursor");
         print_log("          Uses a software cursor instead of the default hardware cursor");
+        print_log("--replay NAME");
+        print_log("          Plays back the recorded replay NAME without drawing and exits,");
+        print_log("          with status 0 if the results match the recording");
         print_log("The last argument, if present, is interpreted as data directory for the Caesar 3 installation");
     }
     return ok;
@@ -7,6 +7,7 @@
 #include "core/log.h"
 #include "core/time.h"
 #include "game/game.h"
+#include "game/replay.h"
 #include "game/settings.h"
 #include "game/system.h"
 #include "graphics/screen.h"
@@ -726,6 +727,11 @@ int main(int argc, char **argv)
 
     setup(&args);
 
+    if (args.replay_name) {
+        int matches = game_replay_play(args.replay_name);
+        SDL_Log("Replay %s: %s", args.replay_name, matches ? "results match the recording" : "results differ");
+        exit_with_status(matches ? 0 : 3);
+    }
 
 
     mouse_set_inside_window(1);
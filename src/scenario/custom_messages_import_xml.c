@@ -181,7 +181,7 @@ static void reset_data(void)
     data.error_line_number = -1;
 }
 
-static int parse_xml(char *buf, int buffer_length)
+static int parse_xml(FILE *file)
 {
     reset_data();
     custom_messages_clear_all();
@@ -190,7 +190,7 @@ static int parse_xml(char *buf, int buffer_length)
         data.success = 0;
     }
     if (data.success) {
-        if (!xml_parser_parse(buf, buffer_length, 1)) {
+        if (!xml_parser_parse_file(file)) {
             data.success = 0;
             custom_messages_clear_all();
         }
@@ -210,50 +210,15 @@ static int parse_xml(char *buf, int buffer_length)
     return data.success;
 }
 
-static char *file_to_buffer(const char *filename, int *output_length)
+int custom_messages_xml_parse_file(const char *filename)
 {
     FILE *file = file_open(filename, "r");
     if (!file) {
-        log_error("Error opening empire file", filename, 0);
-        return 0;
-    }
-    fseek(file, 0, SEEK_END);
-    int size = ftell(file);
-    rewind(file);
-
-    char *buf = malloc(size);
-    if (!buf) {
-        log_error("Error opening empire file", filename, 0);
-        return 0;
-    }
-    memset(buf, 0, size);
-    if (!buf) {
-        log_error("Unable to allocate buffer to read XML file", filename, 0);
-        free(buf);
-        file_close(file);
-        return 0;
-    }
-    *output_length = (int) fread(buf, 1, size, file);
-    if (*output_length > size) {
-        log_error("Unable to read file into buffer", filename, 0);
-        free(buf);
-        file_close(file);
-        *output_length = 0;
+        log_error("Error opening custom messages file", filename, 0);
         return 0;
     }
+    int success = parse_xml(file);
     file_close(file);
-    return buf;
-}
-
-int custom_messages_xml_parse_file(const char *filename)
-{
-    int output_length = 0;
-    char *xml_contents = file_to_buffer(filename, &output_length);
-    if (!xml_contents) {
-        return 0;
-    }
-    int success = parse_xml(xml_contents, output_length);
-    free(xml_contents);
     if (!success) {
         log_error("Error parsing file", filename, 0);
     }
@@ -16,6 +16,7 @@ typedef struct {
 } custom_variable_t;
 
 static array(custom_variable_t) custom_variables;
+static unsigned int change_count;
 
 #define CUSTOM_VARIABLES_SIZE_STEP 8
 
@@ -38,6 +39,7 @@ unsigned int scenario_custom_variable_create(const uint8_t *name, int initial_va
     }
     variable->in_use = 1;
     variable->value = initial_value;
+    change_count++;
     variable->text_display[0] = 0; // Initialize to empty string
     variable->allow_display = 0; // Initialize to not visible
     if (name) {
@@ -51,6 +53,7 @@ void scenario_custom_variable_delete_all(void)
 {
     array_init(custom_variables, CUSTOM_VARIABLES_SIZE_STEP, new_variable, variable_in_use);
     array_advance(custom_variables);
+    change_count++;
 }
 
 unsigned int scenario_custom_variable_get_id_by_name(const uint8_t *name)
@@ -89,6 +92,7 @@ void scenario_custom_variable_delete(unsigned int id)
     custom_variable_t *variable = get_variable(id);
     if (variable) {
         variable->in_use = 0;
+        change_count++;
     }
 }
 
@@ -155,7 +159,15 @@ void scenario_custom_variable_set_value(unsigned int id, int new_value)
     if (!variable) {
         return;
     }
-    variable->value = new_value;
+    if (variable->value != new_value) {
+        variable->value = new_value;
+        change_count++;
+    }
+}
+
+unsigned int scenario_custom_variable_get_change_count(void)
+{
+    return change_count;
 }
 
 void scenario_custom_variable_save_state(buffer *buf)
@@ -178,6 +190,7 @@ void scenario_custom_variable_save_state(buffer *buf)
 void scenario_custom_variable_load_state(buffer *buf, int version)
 {
     unsigned int total_variables = buffer_load_dynamic_array(buf);
+    change_count++;
 
     if (!array_init(custom_variables, CUSTOM_VARIABLES_SIZE_STEP, new_variable, variable_in_use) ||
         !array_expand(custom_variables, total_variables)) {
@@ -201,6 +214,7 @@ void scenario_custom_variable_load_state(buffer *buf, int version)
 
 void scenario_custom_variable_load_state_old_version(buffer *buf)
 {
+    change_count++;
     if (!array_init(custom_variables, CUSTOM_VARIABLES_SIZE_STEP, new_variable, variable_in_use) ||
         !array_expand(custom_variables, MAX_ORIGINAL_CUSTOM_VARIABLES)) {
         log_error("Failed to initialize custom variables array - out of memory. The game will probably crash.", 0, 0);
@@ -94,6 +94,22 @@ int scenario_condition_type_is_met(scenario_condition_t *condition)
     }
 }
 
+condition_dependency scenario_condition_type_get_dependencies(const scenario_condition_t *condition)
+{
+    switch (condition->type) {
+        case CONDITION_TYPE_UNDEFINED:
+            return CONDITION_DEPENDENCY_NONE;
+        case CONDITION_TYPE_TIME_PASSED:
+            return CONDITION_DEPENDENCY_TIME;
+        case CONDITION_TYPE_DIFFICULTY:
+            return CONDITION_DEPENDENCY_DIFFICULTY;
+        case CONDITION_TYPE_CUSTOM_VARIABLE_CHECK:
+            return CONDITION_DEPENDENCY_CUSTOM_VARIABLES;
+        default:
+            return CONDITION_DEPENDENCY_CITY_STATE;
+    }
+}
+
 void scenario_condition_type_delete(scenario_condition_t *condition)
 {
     memset(condition, 0, sizeof(scenario_condition_t));
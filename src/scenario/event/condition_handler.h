@@ -9,6 +9,7 @@ int scenario_condition_group_in_use(const scenario_condition_group_t *group);
 
 void scenario_condition_type_init(scenario_condition_t *condition);
 int scenario_condition_type_is_met(scenario_condition_t *condition);
+condition_dependency scenario_condition_type_get_dependencies(const scenario_condition_t *condition);
 
 void scenario_condition_type_delete(scenario_condition_t *condition);
 void scenario_condition_group_save_state(buffer *buf, const scenario_condition_group_t *condition_group, int link_type,
@@ -111,6 +111,15 @@ enum {
     COMPARISON_TYPE_GREATER_THAN = 6
 };
 
+typedef enum {
+    CONDITION_DEPENDENCY_NONE = 0,
+    CONDITION_DEPENDENCY_TIME = 1 << 0,
+    CONDITION_DEPENDENCY_DIFFICULTY = 1 << 1,
+    CONDITION_DEPENDENCY_CUSTOM_VARIABLES = 1 << 2,
+    // Any other city state, which has no change tracking and must always be evaluated
+    CONDITION_DEPENDENCY_CITY_STATE = 1 << 3
+} condition_dependency;
+
 enum {
     POP_CLASS_UNDEFINED = 0,
     POP_CLASS_ALL = 1,
@@ -142,6 +151,13 @@ typedef struct {
     int parameter5;
 } scenario_action_t;
 
+typedef struct {
+    int is_set;
+    int total_months;
+    int difficulty;
+    unsigned int custom_variable_changes;
+} scenario_event_dependency_state_t;
+
 typedef struct {
     unsigned int id;
     event_state state;
@@ -153,6 +169,7 @@ typedef struct {
     uint8_t name[EVENT_NAME_LENGTH];
     array(scenario_condition_group_t) condition_groups;
     array(scenario_action_t) actions;
+    scenario_event_dependency_state_t unmet_conditions_state; // Not saved, only used to skip unchanged conditions
 } scenario_event_t;
 
 #endif // SCENARIO_EVENT_DATA_H
@@ -3,6 +3,9 @@
 #include "core/encoding.h"
 #include "core/log.h"
 #include "core/random.h"
+#include "game/settings.h"
+#include "game/time.h"
+#include "scenario/custom_variable.h"
 #include "scenario/event/action_handler.h"
 #include "scenario/event/condition_handler.h"
 
@@ -33,6 +36,7 @@ int scenario_event_is_active(const scenario_event_t *event)
 void scenario_event_init(scenario_event_t *event)
 {
     event->state = EVENT_STATE_ACTIVE;
+    event->unmet_conditions_state.is_set = 0;
     scenario_condition_group_t *group;
     scenario_condition_t *condition;
     array_foreach(event->condition_groups, group) {
@@ -200,6 +204,7 @@ int scenario_event_decrease_pause_time(scenario_event_t *event, int months_passe
     }
     if (event->months_until_active == 0) {
         event->state = EVENT_STATE_ACTIVE;
+        event->unmet_conditions_state.is_set = 0;
     }
     return 1;
 }
@@ -214,8 +219,56 @@ int scenario_event_count_conditions(const scenario_event_t *event)
     return total_conditions;
 }
 
+static condition_dependency get_condition_dependencies(const scenario_event_t *event)
+{
+    condition_dependency dependencies = CONDITION_DEPENDENCY_NONE;
+    const scenario_condition_group_t *group;
+    const scenario_condition_t *condition;
+    array_foreach(event->condition_groups, group) {
+        array_foreach(group->conditions, condition) {
+            dependencies |= scenario_condition_type_get_dependencies(condition);
+        }
+    }
+    return dependencies;
+}
+
+static int condition_dependencies_changed(const scenario_event_t *event)
+{
+    const scenario_event_dependency_state_t *state = &event->unmet_conditions_state;
+    if (!state->is_set) {
+        return 1;
+    }
+    condition_dependency dependencies = get_condition_dependencies(event);
+    if (dependencies & CONDITION_DEPENDENCY_CITY_STATE) {
+        return 1;
+    }
+    if ((dependencies & CONDITION_DEPENDENCY_TIME) && state->total_months != game_time_total_months()) {
+        return 1;
+    }
+    if ((dependencies & CONDITION_DEPENDENCY_DIFFICULTY) && state->difficulty != setting_difficulty()) {
+        return 1;
+    }
+    if ((dependencies & CONDITION_DEPENDENCY_CUSTOM_VARIABLES) &&
+        state->custom_variable_changes != scenario_custom_variable_get_change_count()) {
+        return 1;
+    }
+    return 0;
+}
+
+static void remember_unmet_conditions_state(scenario_event_t *event)
+{
+    scenario_event_dependency_state_t *state = &event->unmet_conditions_state;
+    state->is_set = 1;
+    state->total_months = game_time_total_months();
+    state->difficulty = setting_difficulty();
+    state->custom_variable_changes = scenario_custom_variable_get_change_count();
+}
+
 int scenario_event_conditional_execute(scenario_event_t *event)
 {
+    if (event->state != EVENT_STATE_ACTIVE || !condition_dependencies_changed(event)) {
+        return 0;
+    }
     if (conditions_fulfilled(event)) {
         int result = scenario_event_execute(event);
         event->execution_count++;
@@ -228,6 +281,7 @@ int scenario_event_conditional_execute(scenario_event_t *event)
         }
         return result;
     }
+    remember_unmet_conditions_state(event);
     return 0;
 }
 
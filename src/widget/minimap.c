@@ -534,6 +534,36 @@ void widget_minimap_update(const minimap_functions *functions)
     graphics_renderer()->update_custom_image(CUSTOM_IMAGE_MINIMAP);
 }
 
+color_t *widget_minimap_copy_pixels(void)
+{
+    if (!data.cache.buffer) {
+        return 0;
+    }
+    int row_width = data.minimap.width * 2;
+    color_t *pixels = malloc(sizeof(color_t) * row_width * data.minimap.height);
+    if (!pixels) {
+        return 0;
+    }
+    for (int y = 0; y < data.minimap.height; y++) {
+        memcpy(&pixels[y * row_width], &data.cache.buffer[y * data.cache.stride], sizeof(color_t) * row_width);
+    }
+    return pixels;
+}
+
+void widget_minimap_restore_pixels(const minimap_functions *functions, const color_t *pixels)
+{
+    data.functions = functions ? functions : &default_functions;
+    prepare_minimap_cache();
+    if (!data.cache.buffer) {
+        return;
+    }
+    int row_width = data.minimap.width * 2;
+    for (int y = 0; y < data.minimap.height; y++) {
+        memcpy(&data.cache.buffer[y * data.cache.stride], &pixels[y * row_width], sizeof(color_t) * row_width);
+    }
+    graphics_renderer()->update_custom_image(CUSTOM_IMAGE_MINIMAP);
+}
+
 void widget_minimap_draw(int x_offset, int y_offset, int width, int height)
 {
     if (!data.cache.buffer) {
@@ -3,6 +3,7 @@
 
 #include "building/building.h"
 #include "figure/figure.h"
+#include "graphics/color.h"
 #include "input/mouse.h"
 #include "scenario/property.h"
 
@@ -28,6 +29,10 @@ void widget_minimap_invalidate(void);
 
 void widget_minimap_update(const minimap_functions *functions);
 
+color_t *widget_minimap_copy_pixels(void);
+
+void widget_minimap_restore_pixels(const minimap_functions *functions, const color_t *pixels);
+
 void widget_minimap_draw(int x_offset, int y_offset, int width, int height);
 
 void widget_minimap_draw_decorated(int x_offset, int y_offset, int width, int height);
@@ -10,6 +10,7 @@
 #include "city/view.h"
 #include "core/config.h"
 #include "figure/figure.h"
+#include "game/replay.h"
 #include "graphics/button.h"
 #include "graphics/complex_button.h"
 #include "graphics/generic_button.h"
@@ -240,7 +241,9 @@ static void calculate_available_storages(int building_id)
 
     building *b = building_get(data.depot_building_id);
     if (!b->data.depot.current_order.resource_type) {
-        b->data.depot.current_order.resource_type = RESOURCE_MIN_FOOD;
+        order new_order = b->data.depot.current_order;
+        new_order.resource_type = RESOURCE_MIN_FOOD;
+        building_depot_set_order(b, &new_order);
     }
     data.target_resource_id = b->data.depot.current_order.resource_type;
 
@@ -276,11 +279,16 @@ static void calculate_available_storages(int building_id)
             has_valid_dst = dst_state != BUILDING_STORAGE_STATE_NOT_ACCEPTING ? 1 : 0;
         }
     }
+    order new_order = b->data.depot.current_order;
     if (!has_valid_src) {
-        b->data.depot.current_order.src_storage_id = 0;
+        new_order.src_storage_id = 0;
     }
     if (!has_valid_dst) {
-        b->data.depot.current_order.dst_storage_id = 0;
+        new_order.dst_storage_id = 0;
+    }
+    if (new_order.src_storage_id != b->data.depot.current_order.src_storage_id ||
+        new_order.dst_storage_id != b->data.depot.current_order.dst_storage_id) {
+        building_depot_set_order(b, &new_order);
     }
 
 }
@@ -701,10 +709,12 @@ static void set_order_source(const generic_button *button)
         return;
     }
     building *b = building_get(depot_building_id);
-    b->data.depot.current_order.src_storage_id = building_id;
-    if (b->data.depot.current_order.dst_storage_id == building_id) {
-        b->data.depot.current_order.dst_storage_id = 0;
+    order new_order = b->data.depot.current_order;
+    new_order.src_storage_id = building_id;
+    if (new_order.dst_storage_id == building_id) {
+        new_order.dst_storage_id = 0;
     }
+    building_depot_set_order(b, &new_order);
     window_building_info_depot_return_to_main_window();
 }
 
@@ -716,10 +726,12 @@ static void set_order_destination(const generic_button *button)
         return;
     }
     building *b = building_get(depot_building_id);
-    b->data.depot.current_order.dst_storage_id = building_id;
-    if (b->data.depot.current_order.src_storage_id == building_id) {
-        b->data.depot.current_order.src_storage_id = 0;
+    order new_order = b->data.depot.current_order;
+    new_order.dst_storage_id = building_id;
+    if (new_order.src_storage_id == building_id) {
+        new_order.src_storage_id = 0;
     }
+    building_depot_set_order(b, &new_order);
     window_building_info_depot_return_to_main_window();
 }
 
@@ -738,6 +750,7 @@ static void set_camera_position(const generic_button *button)
 static void copy_settings(const generic_button *button)
 {
     building *b = building_get(data.depot_building_id);
+    game_replay_record_copy_settings(b->id);
     building_data_transfer_copy(b, 0);
     calculate_available_storages(data.depot_building_id);
     setup_buttons_for_selected_depot();
@@ -747,6 +760,7 @@ static void copy_settings(const generic_button *button)
 static void paste_settings(const generic_button *button)
 {
     building *b = building_get(data.depot_building_id);
+    game_replay_record_paste_settings(b->id);
     building_data_transfer_paste(b, 0);
     calculate_available_storages(data.depot_building_id);
     setup_buttons_for_selected_depot();
@@ -874,7 +888,9 @@ static void set_order_resource(const generic_button *button)
     resource_type resource_id = button->parameter2;
     if (resource_id >= RESOURCE_MIN && resource_id < RESOURCE_MAX && resource_is_storable(resource_id)) {
         building *b = building_get(depot_building_id);
-        b->data.depot.current_order.resource_type = resource_id;
+        order new_order = b->data.depot.current_order;
+        new_order.resource_type = resource_id;
+        building_depot_set_order(b, &new_order);
         calculate_available_storages(depot_building_id);
         window_building_info_depot_return_to_main_window();
     }
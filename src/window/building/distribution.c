@@ -24,6 +24,7 @@
 #include "empire/object.h"
 #include "empire/trade_route.h"
 #include "figure/figure.h"
+#include "game/replay.h"
 #include "graphics/button.h"
 #include "graphics/generic_button.h"
 #include "graphics/graphics.h"
@@ -238,6 +239,11 @@ static struct {
     int caravanserai_button_y_offset;
     int y_permission_buttons;
     resource_list stored_resources;
+    struct {
+        int redraw_requested;
+        unsigned int resource_focus_button_id;
+        unsigned int partial_resource_focus_button_id;
+    } orders_list;
 } data;
 
 uint8_t quantity_full_button_text[] = "32";
@@ -307,6 +313,26 @@ static int affect_all_button_storage_state(void)
         return REJECT_ALL;
     }
 }
+static void request_orders_list_redraw(void)
+{
+    data.orders_list.redraw_requested = 1;
+}
+
+// The screen is kept between frames, so the resource rows only need to be drawn again
+// when the panel behind them was redrawn or when the focused button changed
+static int orders_list_needs_redraw(void)
+{
+    if (!data.orders_list.redraw_requested &&
+        data.orders_list.resource_focus_button_id == data.resource_focus_button_id &&
+        data.orders_list.partial_resource_focus_button_id == data.partial_resource_focus_button_id) {
+        return 0;
+    }
+    data.orders_list.redraw_requested = 0;
+    data.orders_list.resource_focus_button_id = data.resource_focus_button_id;
+    data.orders_list.partial_resource_focus_button_id = data.partial_resource_focus_button_id;
+    return 1;
+}
+
 static void draw_accept_none_button(int x, int y, int focused, affect_all_button_current_state state)
 {
     button_border_draw(x, y, 20, 20, focused ? 1 : 0);
@@ -756,6 +782,7 @@ void window_building_draw_distributor_orders(building_info_context *c, const uin
     int scrollbar_shown = scrollbar.max_scroll_position > 0;
 
     inner_panel_draw(c->x_offset + 16, y_offset + 42, c->width_blocks - (scrollbar_shown ? 4 : 2), 21);
+    request_orders_list_redraw();
 }
 
 void window_building_draw_distributor_orders_foreground(building_info_context *c)
@@ -801,6 +828,10 @@ void window_building_draw_distributor_orders_foreground(building_info_context *c
 
     scrollbar_draw(&scrollbar);
 
+    if (!orders_list_needs_redraw()) {
+        return;
+    }
+
     int scrollbar_shown = scrollbar.max_scroll_position > 0;
 
     for (unsigned int i = 0; i < scrollbar.elements_in_view && i < data.stored_resources.size; i++) {
@@ -1283,6 +1314,7 @@ void window_building_draw_storage_orders(building_info_context *c)
     int scrollbar_shown = scrollbar.max_scroll_position > 0;
     inner_panel_draw(c->x_offset + 16, y_offset + 42,
         c->width_blocks - (scrollbar_shown ? 4 : 2), 21);
+    request_orders_list_redraw();
 }
 
 void window_building_draw_storage_orders_foreground(building_info_context *c)
@@ -1325,6 +1357,10 @@ void window_building_draw_storage_orders_foreground(building_info_context *c)
 
     scrollbar_draw(&scrollbar);
 
+    if (!orders_list_needs_redraw()) {
+        return;
+    }
+
     const resource_list *list = is_granary(c)
         ? city_resource_get_potential_foods()
         : city_resource_get_potential();
@@ -1476,7 +1512,9 @@ static void market_orders(const generic_button *button)
     int index = button->parameter1;
     building *b = building_get(data.building_id);
     if (index == 0) {
-        if (affect_all_button_distribution_state() == ACCEPT_ALL) {
+        int accept = affect_all_button_distribution_state() == ACCEPT_ALL;
+        game_replay_record_command(REPLAY_COMMAND_ACCEPT_ALL_GOODS, b->id, accept, 0);
+        if (accept) {
             building_distribution_accept_all_goods(b);
         } else {
             building_distribution_unaccept_all_goods(b);
@@ -1552,6 +1590,7 @@ static void storage_toggle_all_states(int param1, int param2)
 {
 
     int storage_id = building_get(data.building_id)->storage_id;
+    game_replay_record_command(REPLAY_COMMAND_STORAGE_ACCEPT_ALL, storage_id, param1 == 0, 0);
     if (param1 == 0) {
         building_storage_accept_all(storage_id);
     } else {
@@ -556,16 +556,7 @@ static void city_mint_conversion_changed(int accepted, int checked)
     if (!accepted) {
         return;
     }
-    building *city_mint = building_get(data.city_mint_id);
-    if (city_mint->output_resource_id == RESOURCE_DENARII) {
-        city_mint->output_resource_id = RESOURCE_GOLD;
-    } else {
-        city_mint->output_resource_id = RESOURCE_DENARII;
-    }
-    city_mint->data.industry.progress = 0;
-    city_mint->data.industry.age_months = 0;
-    city_mint->data.industry.average_production_per_month = 0;
-    city_mint->data.industry.production_current_month = 0;
+    building_industry_switch_mint_output(building_get(data.city_mint_id));
 }
 
 static void set_city_mint_conversion(const generic_button *button)
@@ -8,6 +8,7 @@
 #include "city/finance.h"
 #include "core/dir.h"
 #include "core/image.h"
+#include "game/replay.h"
 #include "graphics/button.h"
 #include "graphics/complex_button.h"
 #include "graphics/generic_button.h"
@@ -274,6 +275,7 @@ void window_building_draw_burning_ruin(building_info_context *c)
 static void trigger_building_repair(const complex_button *button)
 {
     building *b = building_get(button->parameters[0]);
+    game_replay_record_command(REPLAY_COMMAND_REPAIR_BUILDING, b->id, 0, 0);
     building_repair(b);
     window_invalidate();
     window_go_back();
@@ -1320,7 +1320,9 @@ void window_building_info_depot_select_resource(void)
 void window_building_info_depot_toggle_condition_type(void)
 {
     building *b = building_get(context.building_id);
-    b->data.depot.current_order.condition.condition_type = (b->data.depot.current_order.condition.condition_type + 1) % 4;
+    order new_order = b->data.depot.current_order;
+    new_order.condition.condition_type = (new_order.condition.condition_type + 1) % 4;
+    building_depot_set_order(b, &new_order);
     window_invalidate();
 }
 
@@ -1329,7 +1331,9 @@ void window_building_info_depot_toggle_condition_threshold(void)
     building *b = building_get(context.building_id);
     int step = config_get(CONFIG_GP_STORAGE_INCREMENT_4) ? 4 : 8;
     int step_max = config_get(CONFIG_GP_STORAGE_INCREMENT_4) ? 36 : 40;
-    b->data.depot.current_order.condition.threshold = (b->data.depot.current_order.condition.threshold + step) % step_max;
+    order new_order = b->data.depot.current_order;
+    new_order.condition.threshold = (new_order.condition.threshold + step) % step_max;
+    building_depot_set_order(b, &new_order);
     window_invalidate();
 }
 
@@ -1339,7 +1343,9 @@ void window_building_info_depot_toggle_condition_threshold_reverse(void)
     int step = config_get(CONFIG_GP_STORAGE_INCREMENT_4) ? 4 : 8;
     int new_threshold = (b->data.depot.current_order.condition.threshold - step);
     new_threshold = new_threshold < 0 ? 32 : new_threshold;
-    b->data.depot.current_order.condition.threshold = new_threshold;
+    order new_order = b->data.depot.current_order;
+    new_order.condition.threshold = new_threshold;
+    building_depot_set_order(b, &new_order);
     window_invalidate();
 }
 
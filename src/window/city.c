@@ -20,6 +20,7 @@
 #include "figure/formation_legion.h"
 #include "figure/roamer_preview.h"
 #include "game/orientation.h"
+#include "game/replay.h"
 #include "game/settings.h"
 #include "game/state.h"
 #include "game/time.h"
@@ -808,6 +809,7 @@ static void handle_hotkeys(const hotkeys *h)
         int building_id = map_building_at(widget_city_current_grid_offset());
         if (building_id) {
             building *b = building_main(building_get(building_id));
+            game_replay_record_copy_settings(b->id);
             building_data_transfer_copy(b, 0);
         }
     }
@@ -815,6 +817,7 @@ static void handle_hotkeys(const hotkeys *h)
         int building_id = map_building_at(widget_city_current_grid_offset());
         if (building_id) {
             building *b = building_main(building_get(building_id));
+            game_replay_record_paste_settings(b->id);
             building_data_transfer_paste(b, 0);
         }
     }
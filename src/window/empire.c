@@ -13,6 +13,7 @@
 #include "empire/trade_route.h"
 #include "empire/trade_prices.h"
 #include "empire/type.h"
+#include "game/replay.h"
 #include "game/tutorial.h"
 #include "game/system.h"
 #include "graphics/arrow_button.h"
@@ -2164,6 +2165,7 @@ static void confirmed_open_trade_by_route(int accepted, int checked)
 {
     if (accepted) {
         int city_id = empire_city_get_for_trade_route(data.selected_trade_route);
+        game_replay_record_command(REPLAY_COMMAND_OPEN_TRADE_ROUTE, city_id, 0, 0);
         empire_city_open_trade(city_id, 1);
         building_menu_update();
         window_trade_opened_show(city_id);
@@ -179,8 +179,7 @@ static void button_confirm(const generic_button *button)
 {
     // save bet and go back
     if (!city_data.games.chosen_horse && data.chosen_horse && data.bet_amount) {
-        city_data.games.chosen_horse = data.chosen_horse;
-        city_data.games.bet_amount = data.bet_amount;
+        city_race_bet_place(data.chosen_horse, data.bet_amount);
         window_go_back();
     }
 }